@@ -0,0 +1,192 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "components/bounding_box_component/BoundingBoxComponent.h"
+#include "components/graphics_component/GraphicsComponent.h"
+#include "components/physics_component/PhysicsComponent.h"
+#include "entities/EntitiesManager.h"
+#include "entities/Entity.h"
+#include "factories/component/ComponentsFactory.h"
+#include "factories/entity/EntitiesFactory.h"
+#include "handlers/camera/CameraHandler.h"
+#include "handlers/input/KeyHandler.h"
+#include "handlers/input/MouseHandler.h"
+#include "handlers/resources/ResourcesHandler.h"
+#include "libraries/constants/Constants.h"
+#include "libraries/keys/Keys.h"
+#include "platform/sdl/SDLPlatform.h"
+#include "states/DimensionMode.h"
+#include "states/GameState.h"
+#include "states/GameStateManager.h"
+#include "utilities/config_reader/ConfigReader.h"
+#include "utilities/logs_manager/LogsManager.h"
+
+namespace {
+  namespace Constants = Project::Libraries::Constants;
+  namespace Keys = Project::Libraries::Keys;
+
+  constexpr int SCREEN_WIDTH = 640;
+  constexpr int SCREEN_HEIGHT = 480;
+  constexpr int MAP_SIZE = 4096;
+  constexpr size_t PAIR_COUNT = 64;
+  constexpr float PAIR_SPACING = 48.0f;
+  constexpr float PROJECTILE_INSET = 6.0f;
+  constexpr size_t CHECK_FRAMES = 4;
+  constexpr const char* SCRIPT_DIR = "doeville_contact_check";
+
+  struct Template {
+    const char* name;
+    const char* source;
+  };
+
+  const Template TEMPLATES[] = {
+    {"check_state", R"(
+function initialize() end
+function onEnter() end
+function onExit() end
+function update(deltaTime) end
+function render() end
+)"},
+    {"check_target", R"(
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = true, boxes = { { x = 0, y = 0, w = 16, h = 16 } } },
+  PhysicsComponent = { component = "PhysicsComponent", static = false, kinematic = false, gravity = false, mass = 1.0 }
+}
+return { name = "check_target" }
+)"},
+    {"check_projectile", R"(
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = false, surface = "DESTROY_ON_HIT", boxes = { { x = 0, y = 0, w = 4, h = 4 } } },
+  PhysicsComponent = { component = "PhysicsComponent", static = false, kinematic = true, gravity = false, mass = 0.1 }
+}
+return { name = "check_projectile" }
+)"}
+  };
+
+  struct Pair {
+    std::string projectile;
+    std::string target;
+    bool projectileFirst = false;
+  };
+}
+
+int main() {
+  Project::Utilities::LogsManager logsManager;
+  Project::Utilities::ConfigReader configReader{logsManager};
+  Project::Platform::SDLPlatform platform{logsManager};
+  Project::Handlers::ResourcesHandler resourcesHandler{logsManager};
+  Project::Factories::ComponentsFactory componentsFactory{logsManager, configReader, resourcesHandler};
+  Project::States::GameStateManager gameStateManager{static_cast<size_t>(Constants::DEFAULT_STATE_CACHE_LIMIT), logsManager, &platform};
+  Project::Handlers::KeyHandler keyHandler{logsManager, platform, &gameStateManager};
+  Project::Handlers::MouseHandler mouseHandler{logsManager};
+  Project::Handlers::CameraHandler cameraHandler;
+
+  platform.setHeadless(true);
+  if (!platform.init(SCRIPT_DIR, SCREEN_WIDTH, SCREEN_HEIGHT, false, false, false)) {
+    std::fprintf(stderr, "Failed to initialize headless platform.\n");
+    return EXIT_FAILURE;
+  }
+
+  componentsFactory.setRenderer(platform.getRenderer());
+  componentsFactory.setKeyHandler(&keyHandler);
+  componentsFactory.setMouseHandler(&mouseHandler);
+  componentsFactory.setCameraHandler(&cameraHandler);
+  componentsFactory.configurePools();
+  cameraHandler.setSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+  Project::Components::GraphicsComponent::setCameraHandler(&cameraHandler);
+  Project::Components::BoundingBoxComponent::setCameraHandler(&cameraHandler);
+
+  const std::filesystem::path scriptDir = std::filesystem::temp_directory_path() / SCRIPT_DIR;
+  std::error_code ec;
+  std::filesystem::create_directories(scriptDir, ec);
+  auto scriptPath = [&scriptDir](const std::string& name) {
+    return (scriptDir / (name + Constants::LUA_ENTITY_SUFFIX)).string();
+  };
+  for (const Template& tmpl : TEMPLATES) {
+    std::ofstream out(scriptPath(tmpl.name), std::ios::trunc);
+    out << tmpl.source;
+  }
+
+  Project::Factories::EntitiesFactory entitiesFactory(logsManager, configReader, componentsFactory, gameStateManager);
+  auto state = std::make_unique<Project::States::GameState>(platform.getRenderer(), logsManager, resourcesHandler);
+  if (!state->attachLuaScript(scriptPath(TEMPLATES[0].name))) return EXIT_FAILURE;
+
+  auto entitiesManager = std::make_shared<Project::Entities::EntitiesManager>();
+  entitiesManager->setPlatform(&platform);
+  entitiesManager->setLogsManager(&logsManager);
+  state->setEntitiesManager(entitiesManager);
+  state->setEntitiesFactory(&entitiesFactory);
+  state->setGameStateManager(&gameStateManager);
+  state->setPlatform(&platform);
+  state->setDimensionMode(Project::States::DimensionMode::BOUNDED);
+  state->setMapSize(MAP_SIZE, MAP_SIZE);
+  state->initialize();
+  entitiesManager->initialize();
+
+  for (size_t i = 1; i < std::size(TEMPLATES); ++i) {
+    if (!entitiesFactory.createEntityFromLua(scriptPath(TEMPLATES[i].name))) return EXIT_FAILURE;
+  }
+
+  auto spawn = [&](const std::string& name, float x, float y) -> std::shared_ptr<Project::Entities::Entity> {
+    auto entity = entitiesFactory.cloneEntity(name);
+    if (!entity) return nullptr;
+    entity->getLuaStateWrapper().setGlobalNumber(Keys::X, x);
+    entity->getLuaStateWrapper().setGlobalNumber(Keys::Y, y);
+    entity->initialize();
+    return std::shared_ptr<Project::Entities::Entity>(std::move(entity));
+  };
+
+  std::vector<Pair> pairs;
+  for (size_t i = 0; i < PAIR_COUNT; ++i) {
+    const float x = PAIR_SPACING * static_cast<float>(i % (MAP_SIZE / static_cast<int>(PAIR_SPACING)));
+    const float y = PAIR_SPACING * static_cast<float>(i / (MAP_SIZE / static_cast<int>(PAIR_SPACING)));
+
+    std::shared_ptr<Project::Entities::Entity> projectile;
+    std::shared_ptr<Project::Entities::Entity> target;
+    if (i % 2 == 0) {
+      projectile = spawn(TEMPLATES[2].name, x + PROJECTILE_INSET, y + PROJECTILE_INSET);
+      target = spawn(TEMPLATES[1].name, x, y);
+    } else {
+      target = spawn(TEMPLATES[1].name, x, y);
+      projectile = spawn(TEMPLATES[2].name, x + PROJECTILE_INSET, y + PROJECTILE_INSET);
+    }
+    if (!projectile || !target) return EXIT_FAILURE;
+
+    Pair pair;
+    pair.projectileFirst = projectile->getPhysicsComponent() < target->getPhysicsComponent();
+    pair.projectile = entitiesManager->addEntity(projectile, TEMPLATES[2].name);
+    pair.target = entitiesManager->addEntity(target, TEMPLATES[1].name);
+    pairs.push_back(pair);
+  }
+
+  const float deltaTime = static_cast<float>(Constants::DEFAULT_WHOLE / Constants::TARGET_FPS);
+  for (size_t frame = 0; frame < CHECK_FRAMES; ++frame) {
+    state->update(deltaTime);
+  }
+
+  size_t firstOrder = 0;
+  size_t secondOrder = 0;
+  size_t survivors = 0;
+  for (const Pair& pair : pairs) {
+    ++(pair.projectileFirst ? firstOrder : secondOrder);
+    if (entitiesManager->hasEntity(pair.projectile)) {
+      ++survivors;
+      std::printf("projectile %s survived (resolved as %s)\n", pair.projectile.c_str(), pair.projectileFirst ? "first" : "second");
+    }
+  }
+
+  std::printf("contact order check: %zu pairs, projectile first %zu, projectile second %zu, %zu survivors\n",
+    pairs.size(), firstOrder, secondOrder, survivors);
+
+  state.reset();
+  platform.cleanup();
+  return survivors == 0 && firstOrder > 0 && secondOrder > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
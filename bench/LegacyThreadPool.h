@@ -0,0 +1,98 @@
+#ifndef LEGACY_THREAD_POOL_H
+#define LEGACY_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utilities/thread/LockFreeQueue.h"
+
+namespace Project::Benchmarks {
+  class LegacyThreadPool {
+  public:
+    explicit LegacyThreadPool(size_t count)
+      : stop(false), active(0), pending(0), nextQueue(0) {
+      count = std::max<size_t>(1u, count);
+      taskQueues = std::vector<Project::Utilities::LockFreeQueue<std::function<void()>>>(count);
+      workers.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&LegacyThreadPool::worker, this, i);
+      }
+    }
+
+    ~LegacyThreadPool() {
+      stop.store(true, std::memory_order_release);
+      cv.notify_all();
+      for (auto& t : workers) {
+        if (t.joinable()) t.join();
+      }
+    }
+
+    void enqueue(std::function<void()> job) {
+      if (!job || stop.load(std::memory_order_acquire)) return;
+      size_t index = nextQueue.fetch_add(1, std::memory_order_relaxed) % taskQueues.size();
+      taskQueues[index].push(std::move(job));
+      pending.fetch_add(1, std::memory_order_release);
+      std::lock_guard<std::mutex> lock(cvMutex);
+      cv.notify_all();
+    }
+
+    void wait() {
+      std::unique_lock<std::mutex> lock(cvMutex);
+      cv.wait(lock, [this] {
+        return pending.load(std::memory_order_acquire) == 0 && active.load(std::memory_order_acquire) == 0;
+      });
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::vector<Project::Utilities::LockFreeQueue<std::function<void()>>> taskQueues;
+    std::condition_variable cv;
+    std::mutex cvMutex;
+    std::atomic<bool> stop;
+    std::atomic<size_t> active;
+    std::atomic<size_t> pending;
+    std::atomic<size_t> nextQueue;
+
+    void worker(size_t index) {
+      while (true) {
+        std::function<void()> job;
+        bool hasJob = taskQueues[index].pop(job);
+        if (!hasJob) {
+          for (size_t i = 0; i < taskQueues.size(); ++i) {
+            if (i == index) continue;
+            if (taskQueues[i].pop(job)) {
+              hasJob = true;
+              break;
+            }
+          }
+        }
+
+        if (!hasJob) {
+          std::unique_lock<std::mutex> lock(cvMutex);
+          cv.wait(lock, [this] {
+            return stop.load(std::memory_order_acquire) || pending.load(std::memory_order_acquire) > 0;
+          });
+          if (stop.load(std::memory_order_acquire) && pending.load(std::memory_order_acquire) == 0) return;
+          continue;
+        }
+
+        active.fetch_add(1, std::memory_order_acq_rel);
+        job();
+        active.fetch_sub(1, std::memory_order_acq_rel);
+        pending.fetch_sub(1, std::memory_order_acq_rel);
+
+        if (pending.load(std::memory_order_acquire) == 0 && active.load(std::memory_order_acquire) == 0) {
+          std::lock_guard<std::mutex> lock(cvMutex);
+          cv.notify_all();
+        }
+      }
+    }
+  };
+}
+
+#endif
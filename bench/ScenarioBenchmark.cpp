@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "assets/AssetsManager.h"
+#include "components/bounding_box_component/BoundingBoxComponent.h"
+#include "components/graphics_component/GraphicsComponent.h"
+#include "components/physics_component/PhysicsComponent.h"
+#include "components/vision_component/VisionComponent.h"
+#include "entities/EntitiesManager.h"
+#include "entities/Entity.h"
+#include "factories/component/ComponentsFactory.h"
+#include "factories/entity/EntitiesFactory.h"
+#include "handlers/camera/CameraHandler.h"
+#include "handlers/input/KeyHandler.h"
+#include "handlers/input/MouseHandler.h"
+#include "handlers/resources/ResourcesHandler.h"
+#include "handlers/tile/TileHandler.h"
+#include "libraries/constants/Constants.h"
+#include "libraries/keys/Keys.h"
+#include "libraries/modes/BroadPhaseModes.h"
+#include "platform/sdl/SDLPlatform.h"
+#include "states/DimensionMode.h"
+#include "states/GameState.h"
+#include "states/GameStateManager.h"
+#include "utilities/config_reader/ConfigReader.h"
+#include "utilities/logs_manager/LogsManager.h"
+#include "utilities/profiler/Profiler.h"
+#include "utilities/spatial/BroadPhaseTypeResolver.h"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+  using Project::Utilities::Profiler;
+
+  namespace Constants = Project::Libraries::Constants;
+  namespace Keys = Project::Libraries::Keys;
+
+  constexpr int SCREEN_WIDTH = 1280;
+  constexpr int SCREEN_HEIGHT = 720;
+  constexpr size_t DEFAULT_FRAMES = 600;
+  constexpr std::uint32_t BENCH_SEED = 0x5EEDu;
+  constexpr float PAN_SPEED = 240.0f;
+  constexpr int TILE_SIZE = 32;
+  constexpr int TILE_ATLAS_COLUMNS = 4;
+  constexpr const char* DEFAULT_OUTPUT = "bench_results.json";
+  constexpr const char* ALL_SCENARIOS = "all";
+  constexpr const char* FRAME_KEY = "frame";
+  constexpr const char* UPDATE_KEY = "update";
+  constexpr const char* RENDER_KEY = "render";
+  constexpr const char* SCRIPT_DIR = "doeville_bench";
+
+  struct Template {
+    const char* name;
+    const char* source;
+  };
+
+  const Template TEMPLATES[] = {
+    {"bench_state", R"(
+function initialize() end
+function onEnter() end
+function onExit() end
+function update(deltaTime) end
+function render() end
+)"},
+    {"bench_mover", R"(
+group = "bench"
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = false, boxes = { { x = 0, y = 0, w = 8, h = 8 } } },
+  GraphicsComponent = { component = "GraphicsComponent", width = 8, height = 8, color_hex = "#33CC66" },
+  MotionComponent = { component = "MotionComponent", speed = 160.0, use_acceleration = false, friction = 0.0 },
+  PhysicsComponent = { component = "PhysicsComponent", static = false, kinematic = true, gravity = false, mass = 1.0 }
+}
+return { name = "bench_mover" }
+)"},
+    {"bench_collider", R"(
+group = "bench"
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = true, restitution = 1.0, boxes = { { x = 0, y = 0, w = 16, h = 16 } } },
+  GraphicsComponent = { component = "GraphicsComponent", width = 16, height = 16, color_hex = "#CC6633" },
+  PhysicsComponent = { component = "PhysicsComponent", static = false, kinematic = false, gravity = false, mass = 1.0, restitution = 1.0 }
+}
+return { name = "bench_collider" }
+)"},
+    {"bench_occluder", R"(
+group = "bench"
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = true, boxes = { { x = 0, y = 0, w = 32, h = 32 } } },
+  GraphicsComponent = { component = "GraphicsComponent", width = 32, height = 32, color_hex = "#666666" }
+}
+return { name = "bench_occluder" }
+)"},
+    {"bench_light", R"(
+group = "bench"
+components = {
+  LightComponent = { component = "LightComponent", color_hex = "#FFE0A0" }
+}
+return { name = "bench_light" }
+)"},
+    {"bench_particle", R"(
+group = "bench"
+attributes = { "DISPOSABLE" }
+components = {
+  BoundingBoxComponent = { component = "BoundingBoxComponent", solid = false, boxes = { { x = 0, y = 0, w = 4, h = 4 } } },
+  GraphicsComponent = { component = "GraphicsComponent", width = 4, height = 4, color_hex = "#FFFFFF" },
+  PhysicsComponent = { component = "PhysicsComponent", static = false, kinematic = true, gravity = false, mass = 0.1 }
+}
+return { name = "bench_particle" }
+)"}
+  };
+
+  struct Population {
+    const char* templateName;
+    size_t count;
+    float speed;
+  };
+
+  struct Scenario {
+    const char* name;
+    Project::States::DimensionMode dimension;
+    int mapSize;
+    std::vector<Population> populations;
+    const char* stormTemplate;
+    size_t stormPerFrame;
+    size_t stormCap;
+    bool tiled;
+  };
+
+  std::vector<Scenario> makeScenarios() {
+    using Project::States::DimensionMode;
+    return {
+      {"movers", DimensionMode::BOUNDED, 4096, {{"bench_mover", 4000, 160.0f}}, nullptr, 0, 0, false},
+      {"colliders", DimensionMode::BOUNDED, 2048, {{"bench_collider", 2000, 120.0f}}, nullptr, 0, 0, false},
+      {"lights", DimensionMode::BOUNDED, 2048, {{"bench_occluder", 512, 0.0f}, {"bench_light", 256, 0.0f}}, nullptr, 0, 0, false},
+      {"spawn_storm", DimensionMode::BOUNDED, 2048, {}, "bench_particle", 64, 2048, false},
+      {"tilemap", DimensionMode::MAPPED, 8192, {{"bench_mover", 500, 160.0f}}, nullptr, 0, 0, true}
+    };
+  }
+
+  struct Summary {
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+  };
+
+  double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+  }
+
+  Summary summarize(std::vector<double> samples) {
+    Summary summary;
+    if (samples.empty()) return summary;
+    std::sort(samples.begin(), samples.end());
+    double total = 0.0;
+    for (double value : samples) total += value;
+    summary.mean = total / static_cast<double>(samples.size());
+    summary.p50 = percentile(samples, 0.50);
+    summary.p90 = percentile(samples, 0.90);
+    summary.p99 = percentile(samples, 0.99);
+    summary.max = samples.back();
+    return summary;
+  }
+
+  struct Result {
+    std::string name;
+    size_t frames = 0;
+    size_t entities = 0;
+    size_t spawned = 0;
+    std::map<std::string, std::vector<double>> samples;
+  };
+
+  struct Engine {
+    Project::Utilities::LogsManager logsManager;
+    Project::Utilities::ConfigReader configReader{logsManager};
+    Project::Platform::SDLPlatform platform{logsManager};
+    Project::Handlers::ResourcesHandler resourcesHandler{logsManager};
+    Project::Factories::ComponentsFactory componentsFactory{logsManager, configReader, resourcesHandler};
+    Project::Assets::AssetsManager assetsManager{logsManager, resourcesHandler};
+    Project::States::GameStateManager gameStateManager{static_cast<size_t>(Constants::DEFAULT_STATE_CACHE_LIMIT), logsManager, &platform};
+    Project::Handlers::KeyHandler keyHandler{logsManager, platform, &gameStateManager};
+    Project::Handlers::MouseHandler mouseHandler{logsManager};
+    Project::Handlers::CameraHandler cameraHandler;
+    std::filesystem::path scriptDir;
+
+    bool init() {
+      configReader.loadConfig(Keys::CONFIG_FILE);
+      Project::Entities::EntitiesManager::setParallelUpdate(
+        configReader.getBoolValue(Keys::SCRIPTING_SECTION, Keys::SCRIPTING_PARALLEL_UPDATE, false));
+      Project::Systems::PhysicsSystem::setDefaultBroadPhaseType(Project::Utilities::BroadPhaseTypeResolver::resolve(
+        configReader.getValue(Keys::PHYSICS_SECTION, Keys::PHYSICS_BROAD_PHASE, Project::Libraries::Modes::BroadPhases::AUTO)));
+      platform.setHeadless(true);
+      if (!platform.init(SCRIPT_DIR, SCREEN_WIDTH, SCREEN_HEIGHT, false, false, false)) return false;
+
+      componentsFactory.setRenderer(platform.getRenderer());
+      componentsFactory.setKeyHandler(&keyHandler);
+      componentsFactory.setMouseHandler(&mouseHandler);
+      componentsFactory.setAssetsManager(&assetsManager);
+      componentsFactory.setCameraHandler(&cameraHandler);
+      componentsFactory.configurePools();
+
+      cameraHandler.setSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+      cameraHandler.setCullingOffset(Constants::DEFAULT_CAMERA_CULL_OFFSET, Constants::DEFAULT_CAMERA_CULL_OFFSET);
+      Project::Components::GraphicsComponent::setCameraHandler(&cameraHandler);
+      Project::Components::BoundingBoxComponent::setCameraHandler(&cameraHandler);
+      Project::Components::VisionComponent::setCameraHandler(&cameraHandler);
+
+      scriptDir = std::filesystem::temp_directory_path() / SCRIPT_DIR;
+      std::error_code ec;
+      std::filesystem::create_directories(scriptDir, ec);
+      for (const Template& tmpl : TEMPLATES) {
+        std::ofstream out(scriptPath(tmpl.name), std::ios::trunc);
+        if (!out) return false;
+        out << tmpl.source;
+      }
+      return true;
+    }
+
+    std::string scriptPath(const std::string& name) const {
+      return (scriptDir / (name + Constants::LUA_ENTITY_SUFFIX)).string();
+    }
+  };
+
+  class SceneRunner {
+  public:
+    SceneRunner(Engine& engine, const Scenario& scenario, std::uint32_t seed)
+      : engine(engine), scenario(scenario), rng(seed),
+        entitiesFactory(engine.logsManager, engine.configReader, engine.componentsFactory, engine.gameStateManager) {}
+
+    ~SceneRunner() {
+      state.reset();
+      if (atlas) SDL_DestroyTexture(atlas);
+    }
+
+    bool build() {
+      SDL_Renderer* renderer = engine.platform.getRenderer();
+      state = std::make_unique<Project::States::GameState>(renderer, engine.logsManager, engine.resourcesHandler);
+      if (!state->attachLuaScript(engine.scriptPath(TEMPLATES[0].name))) return false;
+
+      auto entitiesManager = std::make_shared<Project::Entities::EntitiesManager>();
+      entitiesManager->setPlatform(&engine.platform);
+      entitiesManager->setLogsManager(&engine.logsManager);
+      state->setEntitiesManager(entitiesManager);
+      state->setEntitiesFactory(&entitiesFactory);
+      state->setGameStateManager(&engine.gameStateManager);
+      state->setPlatform(&engine.platform);
+      state->setDimensionMode(scenario.dimension);
+      state->setMapSize(scenario.mapSize, scenario.mapSize);
+      state->initialize();
+      entitiesManager->initialize();
+
+      if (scenario.tiled && !buildTiles(renderer)) return false;
+
+      for (const Population& population : scenario.populations) {
+        if (!entitiesFactory.hasEntityTemplate(population.templateName) && !loadTemplate(population.templateName)) return false;
+        for (size_t i = 0; i < population.count; ++i) spawn(population.templateName, population.speed);
+      }
+      if (scenario.stormTemplate && !loadTemplate(scenario.stormTemplate)) return false;
+      return true;
+    }
+
+    Result run(size_t frames) {
+      Result result;
+      result.name = scenario.name;
+      result.frames = frames;
+
+      const float deltaTime = static_cast<float>(Constants::DEFAULT_WHOLE / Constants::TARGET_FPS);
+      const float travel = static_cast<float>(std::max(0, scenario.mapSize - SCREEN_WIDTH));
+      Profiler& profiler = Profiler::getInstance();
+
+      for (size_t frame = 0; frame < frames; ++frame) {
+        profiler.beginFrame();
+        auto frameStart = Clock::now();
+
+        float pan = travel > 0.0f ? std::fmod(static_cast<float>(frame) * PAN_SPEED * deltaTime, travel) : 0.0f;
+        engine.cameraHandler.setPosition(pan, pan * static_cast<float>(SCREEN_HEIGHT) / static_cast<float>(SCREEN_WIDTH));
+
+        if (scenario.stormTemplate) {
+          for (size_t i = 0; i < scenario.stormPerFrame; ++i) {
+            storm.push_back(spawn(scenario.stormTemplate, PAN_SPEED));
+            ++result.spawned;
+          }
+          while (storm.size() > scenario.stormCap) {
+            state->getEntitiesManager()->removeEntity(storm.front());
+            storm.pop_front();
+          }
+        }
+
+        auto updateStart = Clock::now();
+        state->update(deltaTime);
+        auto renderStart = Clock::now();
+        state->render();
+        engine.platform.present();
+        auto frameEnd = Clock::now();
+
+        result.samples[UPDATE_KEY].push_back(milliseconds(updateStart, renderStart));
+        result.samples[RENDER_KEY].push_back(milliseconds(renderStart, frameEnd));
+        result.samples[FRAME_KEY].push_back(milliseconds(frameStart, frameEnd));
+        for (const auto& [name, ms] : profiler.getTimes()) {
+          result.samples[name].push_back(ms);
+        }
+      }
+
+      result.entities = state->getEntitiesManager()->getEntityCount();
+      return result;
+    }
+
+  private:
+    Engine& engine;
+    const Scenario& scenario;
+    std::mt19937 rng;
+    Project::Factories::EntitiesFactory entitiesFactory;
+    std::unique_ptr<Project::States::GameState> state;
+    std::deque<std::string> storm;
+    SDL_Texture* atlas = nullptr;
+
+    static double milliseconds(Clock::time_point start, Clock::time_point end) {
+      return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    bool loadTemplate(const std::string& name) {
+      return entitiesFactory.createEntityFromLua(engine.scriptPath(name)) != nullptr;
+    }
+
+    std::string spawn(const std::string& name, float speed) {
+      std::uniform_real_distribution<float> position(0.0f, static_cast<float>(scenario.mapSize));
+      std::uniform_real_distribution<float> velocity(-speed, speed);
+
+      auto entity = entitiesFactory.cloneEntity(name);
+      if (!entity) return Constants::EMPTY_STRING;
+
+      entity->getLuaStateWrapper().setGlobalNumber(Keys::X, position(rng));
+      entity->getLuaStateWrapper().setGlobalNumber(Keys::Y, position(rng));
+      entity->initialize();
+
+      float vx = velocity(rng);
+      float vy = velocity(rng);
+      if (auto* physics = entity->getPhysicsComponent()) {
+        if (speed > 0.0f) physics->setVelocity(vx, vy);
+      }
+
+      std::shared_ptr<Project::Entities::Entity> shared = std::move(entity);
+      return state->getEntitiesManager()->addEntity(shared, name);
+    }
+
+    bool buildTiles(SDL_Renderer* renderer) {
+      const int atlasSize = TILE_SIZE * TILE_ATLAS_COLUMNS;
+      atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, atlasSize, atlasSize);
+      if (!atlas) return false;
+
+      std::vector<Uint32> pixels(static_cast<size_t>(atlasSize) * atlasSize);
+      for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<Uint32>(rng()) | Constants::FULL_ALPHA;
+      }
+      SDL_UpdateTexture(atlas, nullptr, pixels.data(), atlasSize * static_cast<int>(sizeof(Uint32)));
+
+      const int tiles = scenario.mapSize / TILE_SIZE;
+      std::uniform_int_distribution<int> variant(0, TILE_ATLAS_COLUMNS * TILE_ATLAS_COLUMNS - 1);
+      std::vector<Project::Handlers::BuiltTile> built;
+      built.reserve(static_cast<size_t>(tiles) * tiles);
+      for (int row = 0; row < tiles; ++row) {
+        for (int col = 0; col < tiles; ++col) {
+          int v = variant(rng);
+          SDL_Rect src{(v % TILE_ATLAS_COLUMNS) * TILE_SIZE, (v / TILE_ATLAS_COLUMNS) * TILE_SIZE, TILE_SIZE, TILE_SIZE};
+          SDL_Rect dest{col * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE};
+          built.push_back({atlas, src, dest, true});
+        }
+      }
+      state->setMapTiles(std::move(built), 0, 0, scenario.mapSize, scenario.mapSize);
+      return true;
+    }
+  };
+
+  void writeSummary(std::FILE* out, const Summary& s) {
+    std::fprintf(out, "{\"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+      s.mean, s.p50, s.p90, s.p99, s.max);
+  }
+
+  bool writeJson(const std::string& path, const std::vector<Result>& results, size_t frames) {
+    std::FILE* out = std::fopen(path.c_str(), "w");
+    if (!out) return false;
+
+    std::fprintf(out, "{\n  \"seed\": %u,\n  \"frames\": %zu,\n  \"scenarios\": [\n", BENCH_SEED, frames);
+    for (size_t i = 0; i < results.size(); ++i) {
+      const Result& result = results[i];
+      std::fprintf(out, "    {\n      \"name\": \"%s\",\n      \"entities\": %zu,\n      \"spawned\": %zu,\n      \"systems\": {\n",
+        result.name.c_str(), result.entities, result.spawned);
+      size_t index = 0;
+      for (const auto& [name, samples] : result.samples) {
+        std::fprintf(out, "        \"%s\": ", name.c_str());
+        writeSummary(out, summarize(samples));
+        std::fprintf(out, "%s\n", ++index < result.samples.size() ? "," : "");
+      }
+      std::fprintf(out, "      }\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+    return std::fclose(out) == 0;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const std::string selected = argc > 1 ? argv[1] : ALL_SCENARIOS;
+  const size_t frames = argc > 2 ? static_cast<size_t>(std::strtoul(argv[2], nullptr, 10)) : DEFAULT_FRAMES;
+  const std::string output = argc > 3 ? argv[3] : DEFAULT_OUTPUT;
+
+  Engine engine;
+  if (!engine.init()) {
+    std::fprintf(stderr, "Failed to initialize headless benchmark engine.\n");
+    return 1;
+  }
+  Profiler::getInstance().setEnabled(true);
+
+  const std::vector<Scenario> scenarios = makeScenarios();
+  std::vector<Result> results;
+  std::printf("%-12s %10s %10s %10s %10s %10s\n", "scenario", "entities", "mean ms", "p50 ms", "p90 ms", "p99 ms");
+  for (size_t i = 0; i < scenarios.size(); ++i) {
+    const Scenario& scenario = scenarios[i];
+    if (selected != ALL_SCENARIOS && selected != scenario.name) continue;
+
+    SceneRunner runner(engine, scenario, BENCH_SEED + static_cast<std::uint32_t>(i));
+    if (!runner.build()) {
+      std::fprintf(stderr, "Failed to build scenario: %s\n", scenario.name);
+      return 1;
+    }
+    results.push_back(runner.run(frames));
+
+    Summary frame = summarize(results.back().samples[FRAME_KEY]);
+    std::printf("%-12s %10zu %10.3f %10.3f %10.3f %10.3f\n", scenario.name, results.back().entities,
+      frame.mean, frame.p50, frame.p90, frame.p99);
+  }
+
+  if (results.empty()) {
+    std::fprintf(stderr, "Unknown scenario: %s\n", selected.c_str());
+    return 1;
+  }
+  if (!writeJson(output, results, frames)) {
+    std::fprintf(stderr, "Failed to write %s\n", output.c_str());
+    return 1;
+  }
+
+  engine.platform.cleanup();
+  return 0;
+}
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+
+#include "libraries/constants/Constants.h"
+#include "utilities/spatial/SweepAndPruneBroadPhase.h"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+  using Project::Components::BoundingBoxComponent;
+  using Project::Utilities::BroadPhaseProxy;
+  using Project::Utilities::Collider;
+  using Project::Utilities::ColliderPair;
+  using Project::Utilities::SweepAndPruneBroadPhase;
+
+  namespace Constants = Project::Libraries::Constants;
+
+  constexpr std::uint32_t CHECK_SEED = 0x5A9u;
+  constexpr size_t CHECK_FRAMES = 600;
+  constexpr size_t CHECK_CAPACITY = 600;
+  constexpr size_t BURST_INTERVAL = 37;
+  constexpr size_t BURST_SIZE = 160;
+  constexpr size_t TRICKLE_SIZE = 4;
+  constexpr float WORLD_SIZE = 1200.0f;
+  constexpr float MIN_SIZE = 2.0f;
+  constexpr float MAX_SIZE = 60.0f;
+  constexpr float MAX_STEP = 24.0f;
+  constexpr float QUERY_SIZE = 128.0f;
+  constexpr size_t TIMING_COUNTS[] = {10000, 30000};
+  constexpr float TIMING_WORLD_SIZE = 20000.0f;
+
+  using PairSet = std::set<std::pair<BoundingBoxComponent*, BoundingBoxComponent*>>;
+
+  std::pair<BoundingBoxComponent*, BoundingBoxComponent*> makeKey(BoundingBoxComponent* a, BoundingBoxComponent* b) {
+    return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+  }
+
+  BoundingBoxComponent* tag(std::vector<std::uintptr_t>& storage, size_t index) {
+    return reinterpret_cast<BoundingBoxComponent*>(&storage[index]);
+  }
+
+  PairSet bruteForce(const std::vector<BroadPhaseProxy>& proxies) {
+    PairSet pairs;
+    for (size_t i = 0; i < proxies.size(); ++i) {
+      for (size_t j = i + 1; j < proxies.size(); ++j) {
+        if (SDL_HasIntersectionF(&proxies[i].bounds, &proxies[j].bounds)) {
+          pairs.insert(makeKey(proxies[i].collider.box, proxies[j].collider.box));
+        }
+      }
+    }
+    return pairs;
+  }
+
+  size_t runCheck() {
+    std::mt19937 rng(CHECK_SEED);
+    std::uniform_real_distribution<float> position(0.0f, WORLD_SIZE);
+    std::uniform_real_distribution<float> size(MIN_SIZE, MAX_SIZE);
+    std::uniform_real_distribution<float> step(-MAX_STEP, MAX_STEP);
+
+    std::vector<std::uintptr_t> storage(CHECK_CAPACITY + CHECK_FRAMES * BURST_SIZE);
+    std::vector<BroadPhaseProxy> proxies;
+    size_t nextTag = 0;
+
+    SweepAndPruneBroadPhase broadPhase;
+    PairSet tracked;
+    size_t errors = 0;
+    const SDL_FRect world{0.0f, 0.0f, WORLD_SIZE, WORLD_SIZE};
+
+    for (size_t frame = 0; frame < CHECK_FRAMES; ++frame) {
+      const bool burst = frame % BURST_INTERVAL == 0;
+      const size_t churn = burst ? BURST_SIZE : TRICKLE_SIZE;
+
+      for (size_t i = 0; i < churn && !proxies.empty(); ++i) {
+        const size_t index = rng() % proxies.size();
+        proxies[index] = proxies.back();
+        proxies.pop_back();
+      }
+
+      for (size_t i = 0; i < churn && proxies.size() < CHECK_CAPACITY; ++i) {
+        BroadPhaseProxy proxy;
+        proxy.bounds = SDL_FRect{position(rng), position(rng), size(rng), size(rng)};
+        proxy.collider.box = tag(storage, nextTag++);
+        proxies.push_back(proxy);
+      }
+
+      for (auto& proxy : proxies) {
+        proxy.bounds.x += step(rng);
+        proxy.bounds.y += step(rng);
+      }
+
+      broadPhase.build(proxies, world);
+
+      for (const auto& pair : broadPhase.getAddedPairs()) {
+        if (!tracked.insert(makeKey(pair.first.box, pair.second.box)).second) ++errors;
+      }
+      for (const auto& pair : broadPhase.getRemovedPairs()) {
+        if (tracked.erase(makeKey(pair.first.box, pair.second.box)) == 0) ++errors;
+      }
+
+      std::vector<ColliderPair> collected;
+      broadPhase.collectPairs(collected);
+      PairSet current;
+      for (const auto& pair : collected) current.insert(makeKey(pair.first.box, pair.second.box));
+
+      const PairSet expected = bruteForce(proxies);
+      if (current != expected || tracked != expected) {
+        ++errors;
+        std::printf("frame %zu: expected %zu pairs, sweep has %zu, events track %zu\n",
+          frame, expected.size(), current.size(), tracked.size());
+      }
+
+      const SDL_FRect area{position(rng), position(rng), QUERY_SIZE, QUERY_SIZE};
+      std::set<BoundingBoxComponent*> found;
+      std::set<BoundingBoxComponent*> wanted;
+      broadPhase.query(area, [&found](const Collider& collider) { found.insert(collider.box); });
+      for (const auto& proxy : proxies) {
+        if (SDL_HasIntersectionF(&proxy.bounds, &area)) wanted.insert(proxy.collider.box);
+      }
+      if (found != wanted) ++errors;
+    }
+    return errors;
+  }
+
+  void runTiming() {
+    std::mt19937 rng(CHECK_SEED);
+    std::uniform_real_distribution<float> position(0.0f, TIMING_WORLD_SIZE);
+    std::uniform_real_distribution<float> size(MIN_SIZE, MAX_SIZE);
+    const SDL_FRect world{0.0f, 0.0f, TIMING_WORLD_SIZE, TIMING_WORLD_SIZE};
+
+    for (size_t count : TIMING_COUNTS) {
+      std::vector<std::uintptr_t> storage(count);
+      std::vector<BroadPhaseProxy> proxies(count);
+      for (size_t i = 0; i < count; ++i) {
+        proxies[i].bounds = SDL_FRect{position(rng), position(rng), size(rng), size(rng)};
+        proxies[i].collider.box = tag(storage, i);
+      }
+
+      SweepAndPruneBroadPhase broadPhase;
+      auto start = Clock::now();
+      broadPhase.build(proxies, world);
+      const double first = std::chrono::duration<double>(Clock::now() - start).count();
+      const size_t pairs = broadPhase.getAddedPairs().size();
+
+      start = Clock::now();
+      broadPhase.build(proxies, world);
+      const double steady = std::chrono::duration<double>(Clock::now() - start).count();
+
+      std::printf("%zu colliders: first build %.2f ms, steady build %.2f ms, %zu pairs\n",
+        count, first * Constants::MILLISECONDS_PER_SECOND, steady * Constants::MILLISECONDS_PER_SECOND, pairs);
+    }
+  }
+}
+
+int main() {
+  const size_t errors = runCheck();
+  std::printf("sweep and prune check: %zu frames, %zu mismatches\n", CHECK_FRAMES, errors);
+  runTiming();
+  return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
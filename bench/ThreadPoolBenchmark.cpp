@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "LegacyThreadPool.h"
+#include "libraries/constants/NumericConstants.h"
+#include "utilities/thread/ThreadPool.h"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  constexpr size_t FLAT_JOBS = 200000;
+  constexpr size_t FLAT_BATCH = Project::Libraries::Constants::TASK_QUEUE_CAPACITY / 2;
+  constexpr size_t NESTED_ROOTS = 2000;
+  constexpr size_t NESTED_FANOUT = 100;
+  constexpr size_t REPEATS = 5;
+  constexpr size_t WORK_ITERATIONS = 64;
+
+  std::atomic<size_t> sink{0};
+
+  void tinyJob() {
+    size_t value = 0;
+    for (size_t i = 0; i < WORK_ITERATIONS; ++i) {
+      value = value * 31 + i;
+    }
+    sink.fetch_add(value & 1, std::memory_order_relaxed);
+  }
+
+  template <typename Pool>
+  double runFlat(Pool& pool) {
+    auto start = Clock::now();
+    for (size_t submitted = 0; submitted < FLAT_JOBS; submitted += FLAT_BATCH) {
+      const size_t batch = std::min(FLAT_BATCH, FLAT_JOBS - submitted);
+      for (size_t i = 0; i < batch; ++i) {
+        pool.enqueue([]() { tinyJob(); });
+      }
+      pool.wait();
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  template <typename Pool>
+  double runNested(Pool& pool) {
+    auto start = Clock::now();
+    for (size_t i = 0; i < NESTED_ROOTS; ++i) {
+      pool.enqueue([&pool]() {
+        for (size_t j = 0; j < NESTED_FANOUT; ++j) {
+          pool.enqueue([]() { tinyJob(); });
+        }
+      });
+    }
+    pool.wait();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  template <typename Pool, typename Scenario>
+  double bestOf(Pool& pool, Scenario scenario) {
+    double best = 0.0;
+    for (size_t r = 0; r < REPEATS; ++r) {
+      double seconds = scenario(pool);
+      if (r == 0 || seconds < best) best = seconds;
+    }
+    return best;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::vector<size_t> threadCounts{1, 2, 4, 8, 16, 32, 64};
+  if (argc > 1) {
+    threadCounts.clear();
+    for (int i = 1; i < argc; ++i) {
+      threadCounts.push_back(static_cast<size_t>(std::strtoul(argv[i], nullptr, 10)));
+    }
+  }
+
+  const double flatJobs = static_cast<double>(FLAT_JOBS);
+  const double nestedJobs = static_cast<double>(NESTED_ROOTS * (NESTED_FANOUT + 1));
+
+  std::printf("%8s %18s %18s %18s %18s\n", "threads", "legacy flat/s", "stealing flat/s", "legacy nested/s", "stealing nested/s");
+  for (size_t threads : threadCounts) {
+    double legacyFlat = 0.0;
+    double legacyNested = 0.0;
+    {
+      Project::Benchmarks::LegacyThreadPool pool(threads);
+      legacyFlat = bestOf(pool, [](auto& p) { return runFlat(p); });
+      legacyNested = bestOf(pool, [](auto& p) { return runNested(p); });
+    }
+
+    double stealingFlat = 0.0;
+    double stealingNested = 0.0;
+    {
+      Project::Utilities::ThreadPool pool(threads);
+      stealingFlat = bestOf(pool, [](auto& p) { return runFlat(p); });
+      stealingNested = bestOf(pool, [](auto& p) { return runNested(p); });
+    }
+
+    std::printf("%8zu %18.0f %18.0f %18.0f %18.0f\n", threads,
+      flatJobs / legacyFlat, flatJobs / stealingFlat,
+      nestedJobs / legacyNested, nestedJobs / stealingNested);
+  }
+
+  return sink.load() == static_cast<size_t>(-1) ? 1 : 0;
+}
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <string>
 #include <unordered_set>
+#include <utility>
 
 #include <SDL.h>
 
@@ -32,6 +33,7 @@
 #include "services/network/NetworkProtocolResolver.h"
 #include "states/GameState.h"
 #include "states/GameStateManager.h"
+#include "utilities/lua_state_wrapper/LuaStateWrapper.h"
 #include "utilities/physics/PhysicsUtils.h"
 
 namespace Project::Bindings::LuaBindings {
@@ -112,14 +114,14 @@ namespace Project::Bindings::LuaBindings {
     }
 
     if (manager->hasEntity(name)) {
-      manager->removeEntity(name);
+      manager->queueRemoveEntity(name);
       return 0;
     }
 
     if (manager->getGameState()) {
       auto entity = manager->getGameState()->findEntity(name);
       if (entity && entity->getEntitiesManager()) {
-        entity->getEntitiesManager()->removeEntity(name);
+        entity->getEntitiesManager()->queueRemoveEntity(name);
       }
     }
 
@@ -137,11 +139,11 @@ namespace Project::Bindings::LuaBindings {
       const char* name = lua_tostring(L, -1);
       if (name) {
         if (manager->hasEntity(name)) {
-          manager->removeEntity(name);
+          manager->queueRemoveEntity(name);
         } else if (manager->getGameState()) {
           auto entity = manager->getGameState()->findEntity(name);
           if (entity && entity->getEntitiesManager()) {
-            entity->getEntitiesManager()->removeEntity(name);
+            entity->getEntitiesManager()->queueRemoveEntity(name);
           }
         }
       }
@@ -156,7 +158,7 @@ namespace Project::Bindings::LuaBindings {
       return 0;
     }
 
-    lua_getglobal(L, Keys::ID);
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
     const char* name = lua_isstring(L, -1) ? lua_tostring(L, -1) : nullptr;
     lua_pop(L, 1);
     if (!name) {
@@ -164,19 +166,65 @@ namespace Project::Bindings::LuaBindings {
     }
 
     if (manager->hasEntity(name)) {
-      manager->removeEntity(name);
+      manager->queueRemoveEntity(name);
       return 0;
     }
 
     if (manager->getGameState()) {
       auto entity = manager->getGameState()->findEntity(name);
       if (entity && entity->getEntitiesManager()) {
-        entity->getEntitiesManager()->removeEntity(name);
+        entity->getEntitiesManager()->queueRemoveEntity(name);
       }
     }
 
     return 0;
   }
+  int lua_addComponent(lua_State* L) {
+    EntitiesManager* manager = static_cast<EntitiesManager*>(lua_touserdata(L, lua_upvalueindex(1)));
+    const char* componentName = luaL_checkstring(L, 1);
+    if (!manager || !componentName) {
+      return 0;
+    }
+
+    const char* tableName = luaL_optstring(L, Constants::INDEX_TWO, componentName);
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
+    std::string name = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+
+    auto entity = manager->getEntity(name);
+    if (!entity) {
+      return 0;
+    }
+
+    auto component = entity->createComponent(componentName, tableName);
+    if (!component) {
+      return luaL_error(L, ("Failed to create component: " + std::string(componentName)).c_str());
+    }
+
+    manager->queueAddComponent(entity->getHandle(), componentName, std::move(component));
+    return 0;
+  }
+
+  int lua_removeComponent(lua_State* L) {
+    EntitiesManager* manager = static_cast<EntitiesManager*>(lua_touserdata(L, lua_upvalueindex(1)));
+    const char* componentName = luaL_checkstring(L, 1);
+    if (!manager || !componentName) {
+      return 0;
+    }
+
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
+    std::string name = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+
+    auto entity = manager->getEntity(name);
+    if (!entity || !entity->hasComponent(componentName)) {
+      return 0;
+    }
+
+    manager->queueRemoveComponent(entity->getHandle(), componentName);
+    return 0;
+  }
+
 
   int lua_spawnEntity(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(1)));
@@ -309,7 +357,7 @@ namespace Project::Bindings::LuaBindings {
       lua_pop(L, 1);
     }
 
-    box->setIgnoredEntities(targets);
+    manager->applyToEntity(L, entity, [box, targets = std::move(targets)]() { box->setIgnoredEntities(targets); });
     return 0;
   }
 
@@ -332,6 +380,7 @@ namespace Project::Bindings::LuaBindings {
     SDL_Event quitEvent{};
     quitEvent.type = SDL_QUIT;
     SDL_PushEvent(&quitEvent);
+    auto sharedLock = EntitiesManager::lockSharedState();
     platform->requestExit();
     return 0;
   }
@@ -362,6 +411,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraZoomIn(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ZOOM_SPEED));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -375,6 +425,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraZoomOut(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ZOOM_SPEED));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -388,6 +439,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraRotate(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ROTATION_STEP));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -401,6 +453,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraShake(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float duration = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_SHAKE_DURATION));
+    auto sharedLock = EntitiesManager::lockSharedState();
     if (!state || !state->getActiveCamera()) {
       return 0;
     }
@@ -865,7 +918,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* textComp = dynamic_cast<Project::Components::TextComponent*>(entity->getComponent(Components::TEXT_COMPONENT));
     if (!textComp) return 0;
-    textComp->setText(text);
+    manager->applyToEntity(L, entity, [textComp, value = std::string(text)]() { textComp->setText(value); });
     return 0;
   }
 
@@ -885,10 +938,12 @@ namespace Project::Bindings::LuaBindings {
     auto* timer = dynamic_cast<Project::Components::TimerComponent*>(entity->getComponent(Components::TIMER_COMPONENT));
     if (!timer) return 0;
 
-    timer->setActive(active != 0);
-    if (active) {
-      timer->reset();
-    }
+    manager->applyToEntity(L, entity, [timer, active]() {
+      timer->setActive(active != 0);
+      if (active) {
+        timer->reset();
+      }
+    });
     return 0;
   }
 
@@ -908,7 +963,7 @@ namespace Project::Bindings::LuaBindings {
     auto* meter = dynamic_cast<Project::Components::MeterComponent*>(entity->getComponent(Components::METER_COMPONENT));
     if (!meter) return 0;
 
-    meter->setActive(active != 0);
+    manager->applyToEntity(L, entity, [meter, active]() { meter->setActive(active != 0); });
     return 0;
   }
 
@@ -936,7 +991,7 @@ namespace Project::Bindings::LuaBindings {
     }
 
     SDL_Color color{static_cast<Uint8>(r), static_cast<Uint8>(g), static_cast<Uint8>(b), static_cast<Uint8>(a)};
-    gfx->setColor(color);
+    manager->applyToEntity(L, entity, [gfx, color]() { gfx->setColor(color); });
     return 0;
   }
 
@@ -957,7 +1012,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->add(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->add(keyName, amount); });
     return 0;
   }
 
@@ -978,7 +1033,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->subtract(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->subtract(keyName, amount); });
     return 0;
   }
 
@@ -999,7 +1054,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->multiply(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->multiply(keyName, amount); });
     return 0;
   }
 
@@ -1020,7 +1075,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->divide(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->divide(keyName, amount); });
     return 0;
   }
 
@@ -1042,11 +1097,15 @@ namespace Project::Bindings::LuaBindings {
 
     float value = static_cast<float>(luaL_checknumber(L, 3));
     float limit = 0.0f;
+    bool hasLimit = false;
     if (lua_gettop(L) >= 4 && lua_isnumber(L, 4)) {
       limit = static_cast<float>(lua_tonumber(L, 4));
-      numeric->setLimit(key, limit);
+      hasLimit = true;
     }
-    numeric->setValue(key, value);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), value, limit, hasLimit]() {
+      if (hasLimit) numeric->setLimit(keyName, limit);
+      numeric->setValue(keyName, value);
+    });
     return 0;
   }
 
@@ -1092,7 +1151,7 @@ namespace Project::Bindings::LuaBindings {
     auto* timer = dynamic_cast<Project::Components::TimerComponent*>(entity->getComponent(Components::TIMER_COMPONENT));
     if (!timer) return 0;
 
-    timer->stop();
+    manager->applyToEntity(L, entity, [timer]() { timer->stop(); });
     return 0;
   }
 
@@ -1111,7 +1170,7 @@ namespace Project::Bindings::LuaBindings {
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
 
-    motion->brake();
+    manager->applyToEntity(L, entity, [motion]() { motion->brake(); });
     return 0;
   }
   
@@ -1129,7 +1188,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
-    motion->turn(speed, true);
+    manager->applyToEntity(L, entity, [motion, speed]() { motion->turn(speed, true); });
     return 0;
   }
 
@@ -1147,7 +1206,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
-    motion->turn(speed, false);
+    manager->applyToEntity(L, entity, [motion, speed]() { motion->turn(speed, false); });
     return 0;
   }
 
@@ -1185,82 +1244,30 @@ namespace Project::Bindings::LuaBindings {
       }
     }
 
-    const auto& myRects = myBox->getBoxes();
-    const auto& myCircles = myBox->getCircles();
-    const auto& myOBB = myBox->getOrientedBoxes();
-    const bool myRot = myBox->isRotationEnabled();
-
-    for (const auto& [id, other] : manager->getAllEntities()) {
-      auto otherEntity = other.get();
-      if (!otherEntity || otherEntity == entity.get()) continue;
+    EntitiesManager* owner = entity->getEntitiesManager() ? entity->getEntitiesManager() : manager;
+    const Entity* collided = nullptr;
+    owner->getPhysicsSystem().getContactCache().forEachContact(entity->getHandle(), [&](Project::Entities::EntityHandle handle) {
+      if (collided) return;
+      const Entity* other = owner->resolveEntity(handle);
+      if (!other || other == entity.get()) return;
       if (!targets.empty()) {
         bool match = false;
         for (const auto& t : targets) {
-          if (otherEntity->getEntityName() == t) { match = true; break; }
-        }
-        if (!match) continue;
-      }
-      auto* otherBox = dynamic_cast<Project::Components::BoundingBoxComponent*>(otherEntity->getComponent(Components::BOUNDING_BOX_COMPONENT));
-      if (!otherBox) continue;
-
-      const auto& otherRects = otherBox->getBoxes();
-      const auto& otherCircles = otherBox->getCircles();
-      const auto& otherOBB = otherBox->getOrientedBoxes();
-      const bool otherRot = otherBox->isRotationEnabled();
-
-      // Box vs Box
-      for (size_t i = 0; i < myRects.size(); ++i) {
-        for (size_t j = 0; j < otherRects.size(); ++j) {
-          bool collides = false;
-          if (myRot || otherRot) {
-            if (i < myOBB.size() && j < otherOBB.size()) {
-              collides = Project::Utilities::PhysicsUtils::checkCollision(myOBB[i], otherOBB[j]);
-            }
-          } else {
-            collides = Project::Utilities::PhysicsUtils::checkCollision(myRects[i], otherRects[j]);
-          }
-          if (collides) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return 1;
-          }
-        }
-      }
-
-      // Box vs Circle
-      for (const auto& rect : myRects) {
-        for (const auto& circle : otherCircles) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(rect, circle)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return 1;
-          }
+          if (other->getEntityName() == t) { match = true; break; }
         }
+        if (!match) return;
       }
+      collided = other;
+    });
 
-      // Circle vs Circle
-      for (const auto& c1 : myCircles) {
-        for (const auto& c2 : otherCircles) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(c1, c2)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return 1;
-          }
-        }
-      }
-
-      // Circle vs Box
-      for (const auto& circle : myCircles) {
-        for (const auto& rect : otherRects) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(rect, circle)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return 1;
-          }
-        }
-      }
+    if (collided) {
+      lua_pushstring(L, collided->getEntityID().c_str());
+    } else {
+      lua_pushnil(L);
     }
-
-    lua_pushnil(L);
     return 1;
   }
-  
+
   int lua_factoryChangeState(lua_State* L) {
     auto* manager = static_cast<GameStateManager*>(lua_touserdata(L, lua_upvalueindex(1)));
     if (!manager) {
@@ -65,6 +65,8 @@ namespace Project::Bindings {
     int lua_destroyEntity(lua_State* L);
     int lua_destroyEntities(lua_State* L);
     int lua_destroySelf(lua_State* L);
+    int lua_addComponent(lua_State* L);
+    int lua_removeComponent(lua_State* L);
 
     // EntitiesFactory bindings
     int lua_factoryChangeState(lua_State* L);
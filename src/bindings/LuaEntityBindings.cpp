@@ -3,6 +3,7 @@
 #include <cmath>
 #include <string>
 #include <unordered_set>
+#include <utility>
 
 #include "components/ComponentType.h"
 #include "components/bounding_box_component/BoundingBoxComponent.h"
@@ -26,6 +27,7 @@
 #include "services/network/NetworkProtocolResolver.h"
 #include "states/GameState.h"
 #include "states/GameStateManager.h"
+#include "utilities/lua_state_wrapper/LuaStateWrapper.h"
 #include "utilities/physics/PhysicsUtils.h"
 
 namespace Project::Bindings::LuaBindings {
@@ -73,79 +75,27 @@ namespace Project::Bindings::LuaBindings {
       }
     }
 
-    const auto& myRects = myBox->getBoxes();
-    const auto& myCircles = myBox->getCircles();
-    const auto& myOBB = myBox->getOrientedBoxes();
-    const bool myRot = myBox->isRotationEnabled();
-
-    for (const auto& [id, other] : manager->getAllEntities()) {
-      auto otherEntity = other.get();
-      if (!otherEntity || otherEntity == entity.get()) continue;
+    EntitiesManager* owner = entity->getEntitiesManager() ? entity->getEntitiesManager() : manager;
+    const Entity* collided = nullptr;
+    owner->getPhysicsSystem().getContactCache().forEachContact(entity->getHandle(), [&](Project::Entities::EntityHandle handle) {
+      if (collided) return;
+      const Entity* other = owner->resolveEntity(handle);
+      if (!other || other == entity.get()) return;
       if (!targets.empty()) {
         bool match = false;
         for (const auto& t : targets) {
-          if (otherEntity->getEntityName() == t) { match = true; break; }
-        }
-        if (!match) continue;
-      }
-      auto* otherBox = dynamic_cast<Project::Components::BoundingBoxComponent*>(otherEntity->getComponent(Components::BOUNDING_BOX_COMPONENT));
-      if (!otherBox) continue;
-
-      const auto& otherRects = otherBox->getBoxes();
-      const auto& otherCircles = otherBox->getCircles();
-      const auto& otherOBB = otherBox->getOrientedBoxes();
-      const bool otherRot = otherBox->isRotationEnabled();
-
-      // Box vs Box
-      for (size_t i = 0; i < myRects.size(); ++i) {
-        for (size_t j = 0; j < otherRects.size(); ++j) {
-          bool collides = false;
-          if (myRot || otherRot) {
-            if (i < myOBB.size() && j < otherOBB.size()) {
-              collides = Project::Utilities::PhysicsUtils::checkCollision(myOBB[i], otherOBB[j]);
-            }
-          } else {
-            collides = Project::Utilities::PhysicsUtils::checkCollision(myRects[i], otherRects[j]);
-          }
-          if (collides) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return Constants::INDEX_ONE;
-          }
-        }
-      }
-
-      // Box vs Circle
-      for (const auto& rect : myRects) {
-        for (const auto& circle : otherCircles) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(rect, circle)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return Constants::INDEX_ONE;
-          }
+          if (other->getEntityName() == t) { match = true; break; }
         }
+        if (!match) return;
       }
+      collided = other;
+    });
 
-      // Circle vs Circle
-      for (const auto& c1 : myCircles) {
-        for (const auto& c2 : otherCircles) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(c1, c2)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return Constants::INDEX_ONE;
-          }
-        }
-      }
-
-      // Circle vs Box
-      for (const auto& circle : myCircles) {
-        for (const auto& rect : otherRects) {
-          if (Project::Utilities::PhysicsUtils::checkCollision(rect, circle)) {
-            lua_pushstring(L, otherEntity->getEntityID().c_str());
-            return Constants::INDEX_ONE;
-          }
-        }
-      }
+    if (collided) {
+      lua_pushstring(L, collided->getEntityID().c_str());
+    } else {
+      lua_pushnil(L);
     }
-
-    lua_pushnil(L);
     return Constants::INDEX_ONE;
   }
 
@@ -401,7 +351,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* textComp = dynamic_cast<Project::Components::TextComponent*>(entity->getComponent(Components::TEXT_COMPONENT));
     if (!textComp) return 0;
-    textComp->setText(text);
+    manager->applyToEntity(L, entity, [textComp, value = std::string(text)]() { textComp->setText(value); });
     return 0;
   }
 
@@ -421,10 +371,12 @@ namespace Project::Bindings::LuaBindings {
     auto* timer = dynamic_cast<Project::Components::TimerComponent*>(entity->getComponent(Components::TIMER_COMPONENT));
     if (!timer) return 0;
 
-    timer->setActive(active != 0);
-    if (active) {
-      timer->reset();
-    }
+    manager->applyToEntity(L, entity, [timer, active]() {
+      timer->setActive(active != 0);
+      if (active) {
+        timer->reset();
+      }
+    });
     return 0;
   }
 
@@ -444,7 +396,7 @@ namespace Project::Bindings::LuaBindings {
     auto* meter = dynamic_cast<Project::Components::MeterComponent*>(entity->getComponent(Components::METER_COMPONENT));
     if (!meter) return 0;
 
-    meter->setActive(active != 0);
+    manager->applyToEntity(L, entity, [meter, active]() { meter->setActive(active != 0); });
     return 0;
   }
 
@@ -472,7 +424,7 @@ namespace Project::Bindings::LuaBindings {
     }
 
     SDL_Color color{static_cast<Uint8>(r), static_cast<Uint8>(g), static_cast<Uint8>(b), static_cast<Uint8>(a)};
-    gfx->setColor(color);
+    manager->applyToEntity(L, entity, [gfx, color]() { gfx->setColor(color); });
     return 0;
   }
 
@@ -493,7 +445,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->add(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->add(keyName, amount); });
     return 0;
   }
 
@@ -514,7 +466,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->subtract(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->subtract(keyName, amount); });
     return 0;
   }
 
@@ -535,7 +487,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->multiply(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->multiply(keyName, amount); });
     return 0;
   }
 
@@ -556,7 +508,7 @@ namespace Project::Bindings::LuaBindings {
     if (!numeric) return 0;
 
     float amount = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
-    numeric->divide(key, amount);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), amount]() { numeric->divide(keyName, amount); });
     return 0;
   }
 
@@ -578,11 +530,15 @@ namespace Project::Bindings::LuaBindings {
 
     float value = static_cast<float>(luaL_checknumber(L, Constants::INDEX_THREE));
     float limit = 0.0f;
+    bool hasLimit = false;
     if (lua_gettop(L) >= Constants::INDEX_FOUR && lua_isnumber(L, Constants::INDEX_FOUR)) {
       limit = static_cast<float>(lua_tonumber(L, Constants::INDEX_FOUR));
-      numeric->setLimit(key, limit);
+      hasLimit = true;
     }
-    numeric->setValue(key, value);
+    manager->applyToEntity(L, entity, [numeric, keyName = std::string(key), value, limit, hasLimit]() {
+      if (hasLimit) numeric->setLimit(keyName, limit);
+      numeric->setValue(keyName, value);
+    });
     return 0;
   }
 
@@ -628,7 +584,7 @@ namespace Project::Bindings::LuaBindings {
     auto* timer = dynamic_cast<Project::Components::TimerComponent*>(entity->getComponent(Components::TIMER_COMPONENT));
     if (!timer) return 0;
 
-    timer->stop();
+    manager->applyToEntity(L, entity, [timer]() { timer->stop(); });
     return 0;
   }
 
@@ -647,7 +603,7 @@ namespace Project::Bindings::LuaBindings {
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
 
-    motion->brake();
+    manager->applyToEntity(L, entity, [motion]() { motion->brake(); });
     return 0;
   }
 
@@ -665,7 +621,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
-    motion->turn(speed, true);
+    manager->applyToEntity(L, entity, [motion, speed]() { motion->turn(speed, true); });
     return 0;
   }
 
@@ -683,7 +639,7 @@ namespace Project::Bindings::LuaBindings {
     if (!entity) return 0;
     auto* motion = dynamic_cast<Project::Components::MotionComponent*>(entity->getComponent(Components::MOTION_COMPONENT));
     if (!motion) return 0;
-    motion->turn(speed, false);
+    manager->applyToEntity(L, entity, [motion, speed]() { motion->turn(speed, false); });
     return 0;
   }
 
@@ -712,7 +668,7 @@ namespace Project::Bindings::LuaBindings {
       lua_pop(L, 1);
     }
 
-    box->setIgnoredEntities(targets);
+    manager->applyToEntity(L, entity, [box, targets = std::move(targets)]() { box->setIgnoredEntities(targets); });
     return 0;
   }
 
@@ -758,14 +714,14 @@ namespace Project::Bindings::LuaBindings {
     }
 
     if (manager->hasEntity(name)) {
-      manager->removeEntity(name);
+      manager->queueRemoveEntity(name);
       return 0;
     }
 
     if (manager->getGameState()) {
       auto entity = manager->getGameState()->findEntity(name);
       if (entity && entity->getEntitiesManager()) {
-        entity->getEntitiesManager()->removeEntity(name);
+        entity->getEntitiesManager()->queueRemoveEntity(name);
       }
     }
 
@@ -783,11 +739,11 @@ namespace Project::Bindings::LuaBindings {
       const char* name = lua_tostring(L, -Constants::INDEX_ONE);
       if (name) {
         if (manager->hasEntity(name)) {
-          manager->removeEntity(name);
+          manager->queueRemoveEntity(name);
         } else if (manager->getGameState()) {
           auto entity = manager->getGameState()->findEntity(name);
           if (entity && entity->getEntitiesManager()) {
-            entity->getEntitiesManager()->removeEntity(name);
+            entity->getEntitiesManager()->queueRemoveEntity(name);
           }
         }
       }
@@ -797,6 +753,76 @@ namespace Project::Bindings::LuaBindings {
   }
 
   int lua_destroySelf(lua_State* L) {
+    EntitiesManager* manager = static_cast<EntitiesManager*>(lua_touserdata(L, lua_upvalueindex(1)));
+    if (!manager) {
+      return 0;
+    }
+
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
+    std::string name = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+    if (name.empty()) {
+      return 0;
+    }
+
+    if (manager->hasEntity(name)) {
+      manager->queueRemoveEntity(name);
+      return 0;
+    }
+
+    if (manager->getGameState()) {
+      auto entity = manager->getGameState()->findEntity(name);
+      if (entity && entity->getEntitiesManager()) {
+        entity->getEntitiesManager()->queueRemoveEntity(name);
+      }
+    }
 
+    return 0;
   }
+  int lua_addComponent(lua_State* L) {
+    EntitiesManager* manager = static_cast<EntitiesManager*>(lua_touserdata(L, lua_upvalueindex(1)));
+    const char* componentName = luaL_checkstring(L, 1);
+    if (!manager || !componentName) {
+      return 0;
+    }
+
+    const char* tableName = luaL_optstring(L, Constants::INDEX_TWO, componentName);
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
+    std::string name = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+
+    auto entity = manager->getEntity(name);
+    if (!entity) {
+      return 0;
+    }
+
+    auto component = entity->createComponent(componentName, tableName);
+    if (!component) {
+      return luaL_error(L, ("Failed to create component: " + std::string(componentName)).c_str());
+    }
+
+    manager->queueAddComponent(entity->getHandle(), componentName, std::move(component));
+    return 0;
+  }
+
+  int lua_removeComponent(lua_State* L) {
+    EntitiesManager* manager = static_cast<EntitiesManager*>(lua_touserdata(L, lua_upvalueindex(1)));
+    const char* componentName = luaL_checkstring(L, 1);
+    if (!manager || !componentName) {
+      return 0;
+    }
+
+    Project::Utilities::LuaStateWrapper::getScopedGlobal(L, Keys::ID);
+    std::string name = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+
+    auto entity = manager->getEntity(name);
+    if (!entity || !entity->hasComponent(componentName)) {
+      return 0;
+    }
+
+    manager->queueRemoveComponent(entity->getHandle(), componentName);
+    return 0;
+  }
+
 }
@@ -33,6 +33,8 @@ namespace Project::Bindings::LuaBindings {
   int lua_destroyEntity(lua_State* L);
   int lua_destroyEntities(lua_State* L);
   int lua_destroySelf(lua_State* L);
+  int lua_addComponent(lua_State* L);
+  int lua_removeComponent(lua_State* L);
   int lua_factoryChangeState(lua_State* L);
   int lua_spawn(lua_State* L);
 }
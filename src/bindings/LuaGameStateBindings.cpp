@@ -76,6 +76,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraShake(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float duration = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_SHAKE_DURATION));
+    auto sharedLock = EntitiesManager::lockSharedState();
     if (!state || !state->getActiveCamera()) {
       return 0;
     }
@@ -86,6 +87,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraRotate(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ROTATION_STEP));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -99,6 +101,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraZoomIn(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ZOOM_SPEED));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -112,6 +115,7 @@ namespace Project::Bindings::LuaBindings {
   int lua_cameraZoomOut(lua_State* L) {
     GameState* state = static_cast<GameState*>(lua_touserdata(L, lua_upvalueindex(Constants::INDEX_ONE)));
     float amount = static_cast<float>(luaL_optnumber(L, Constants::INDEX_ONE, Constants::DEFAULT_CAMERA_ZOOM_SPEED));
+    auto sharedLock = EntitiesManager::lockSharedState();
     auto* cam = state ? state->getActiveCamera() : nullptr;
     auto* handler = Project::Components::GraphicsComponent::getCameraHandler();
     if (cam) {
@@ -151,6 +155,7 @@ namespace Project::Bindings::LuaBindings {
     SDL_Event quitEvent{};
     quitEvent.type = SDL_QUIT;
     SDL_PushEvent(&quitEvent);
+    auto sharedLock = EntitiesManager::lockSharedState();
     platform->requestExit();
     return 0;
   }
@@ -404,7 +409,7 @@ namespace Project::Bindings::LuaBindings {
 
     if (isGlobal) {
       if (state->getGlobalEntitiesManager()) {
-        state->getGlobalEntitiesManager()->addEntity(shared, name);
+        state->getGlobalEntitiesManager()->queueAddEntity(shared, name);
       } else {
         luaL_error(L, "Global EntitiesManager not set for this state.");
       }
@@ -417,12 +422,12 @@ namespace Project::Bindings::LuaBindings {
       }
 
       if (mgr) {
-        mgr->addEntity(shared, name);
+        mgr->queueAddEntity(shared, name);
       } else {
         luaL_error(L, "No layers available in LayersManager.");
       }
     } else if (state->getEntitiesManager()) {
-      state->getEntitiesManager()->addEntity(shared, name);
+      state->getEntitiesManager()->queueAddEntity(shared, name);
     } else {
       luaL_error(L, "EntitiesManager not set for this state.");
     }
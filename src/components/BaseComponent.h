@@ -3,6 +3,7 @@
 
 #include "BaseComponentData.h"
 
+#include <atomic>
 #include <string>
 
 #include "interfaces/build_interface/Buildable.h"
@@ -30,12 +31,19 @@ namespace Project::Components {
     void setClass(const std::string& _classs) { data.componentClass = _classs; }
     const std::string& getClass() const { return data.componentClass; }
 
-    void setActive(bool _active) { data.active = _active; }
+    void setActive(bool _active) { data.active = _active; markPayloadDirty(); }
     bool isActive() const { return data.active; }
 
+    // Set by components whose archetype payload went stale; the storage rewrites only flagged rows.
+    void markPayloadDirty() { payloadDirty.store(true, std::memory_order_release); }
+    bool consumePayloadDirty() { return payloadDirty.exchange(false, std::memory_order_acq_rel); }
+
   protected:
     Project::Utilities::LogsManager& logsManager;
     BaseComponentData data;
+
+  private:
+    std::atomic<bool> payloadDirty{true};
   };
 }
 
@@ -15,7 +15,8 @@ namespace Project::Components {
     ~BehaviorComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::BEHAVIOR; }
+    static constexpr ComponentType TYPE = ComponentType::BEHAVIOR;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
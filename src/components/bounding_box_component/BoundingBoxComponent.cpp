@@ -12,6 +12,7 @@
 #include "libraries/categories/Categories.h"
 #include "libraries/constants/FloatConstants.h"
 #include "libraries/keys/Keys.h"
+#include "utilities/physics/PhysicsUtils.h"
 
 namespace Project::Components {
    Project::Handlers::CameraHandler* BoundingBoxComponent::cameraHandler = nullptr;
@@ -170,6 +171,12 @@ namespace Project::Components {
     markDirty();
   }
 
+  void BoundingBoxComponent::copyFrom(const BoundingBoxComponent& other) {
+    data = other.data;
+    useProxy = other.useProxy;
+    markDirty();
+  }
+
   void BoundingBoxComponent::addBox(const SDL_FRect& rect) {
     data.boxes.push_back(rect);
     updateWorldBoxes();
@@ -284,6 +291,55 @@ namespace Project::Components {
            surface == SurfaceType::GHOST_PASS;
   }
 
+  void BoundingBoxComponent::writePayload(Payload& payload) const {
+    const auto& boxes = getBoxes();
+    payload.hasBounds = !boxes.empty();
+    payload.bounds = payload.hasBounds ? boxes.front() : SDL_FRect{0.0f, 0.0f, 0.0f, 0.0f};
+    payload.active = isActive();
+    payload.solid = isSolid();
+  }
+
+  bool BoundingBoxComponent::intersects(const BoundingBoxComponent& other) const {
+    using Project::Utilities::PhysicsUtils;
+
+    const auto& myRects = getBoxes();
+    const auto& myCircles = getCircles();
+    const auto& myOBB = getOrientedBoxes();
+    const bool myRot = isRotationEnabled();
+
+    const auto& otherRects = other.getBoxes();
+    const auto& otherCircles = other.getCircles();
+    const auto& otherOBB = other.getOrientedBoxes();
+    const bool otherRot = other.isRotationEnabled();
+
+    for (size_t i = 0; i < myRects.size(); ++i) {
+      for (size_t j = 0; j < otherRects.size(); ++j) {
+        if (myRot || otherRot) {
+          if (i < myOBB.size() && j < otherOBB.size() && PhysicsUtils::checkCollision(myOBB[i], otherOBB[j])) return true;
+        } else if (PhysicsUtils::checkCollision(myRects[i], otherRects[j])) {
+          return true;
+        }
+      }
+    }
+
+    for (const auto& rect : myRects) {
+      for (const auto& circle : otherCircles) {
+        if (PhysicsUtils::checkCollision(rect, circle)) return true;
+      }
+    }
+
+    for (const auto& c1 : myCircles) {
+      for (const auto& c2 : otherCircles) {
+        if (PhysicsUtils::checkCollision(c1, c2)) return true;
+      }
+      for (const auto& rect : otherRects) {
+        if (PhysicsUtils::checkCollision(rect, c1)) return true;
+      }
+    }
+
+    return false;
+  }
+
   bool BoundingBoxComponent::handleSurfaceInteraction(
     SurfaceType surface, Project::Entities::Entity* target,
     const SDL_FPoint& offset, float bounce, float fric,
@@ -316,7 +372,7 @@ namespace Project::Components {
         if (target) {
            auto* manager = target->getEntitiesManager();
           if (manager) {
-            manager->removeEntity(target->getEntityID());
+            manager->queueRemoveEntity(target->getHandle());
           }
         }
         break;
@@ -389,9 +445,11 @@ namespace Project::Components {
 
   void BoundingBoxComponent::markDirty() {
     worldBoxesDirty = true;
+    markPayloadDirty();
   }
 
   void BoundingBoxComponent::updateWorldBoxes() {
+    markPayloadDirty();
     if (worldBoxes.size() != data.boxes.size()) {
       worldBoxes.resize(data.boxes.size());
       data.orientedBoxes.resize(data.boxes.size());
@@ -20,15 +20,24 @@ namespace Project::Entities { class Entity; }
 namespace Project::Components {
   class BoundingBoxComponent : public BaseComponent, public PositionableComponent, public Project::Interfaces::Rotatable {
   public:
+    struct Payload {
+      SDL_FRect bounds{0.0f, 0.0f, 0.0f, 0.0f};
+      bool hasBounds = false;
+      bool active = false;
+      bool solid = false;
+    };
+
     explicit BoundingBoxComponent(Project::Utilities::LogsManager& logsManager, SDL_Renderer* renderer, Project::Handlers::KeyHandler* keyHandler, SDL_Color debugColor);
     static void setCameraHandler(Project::Handlers::CameraHandler* handler);
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::BOUNDING_BOX; }
+    static constexpr ComponentType TYPE = ComponentType::BOUNDING_BOX;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const BoundingBoxComponent& other);
 
     void addBox(const SDL_FRect& rect);
     void addCircle(float x, float y, float r);
@@ -42,6 +51,8 @@ namespace Project::Components {
     const std::vector<Project::Utilities::Capsule>& getCapsules() const { return worldCapsules; }
 
     bool isInteractive() const;
+    bool intersects(const BoundingBoxComponent& other) const;
+    void writePayload(Payload& payload) const;
 
     bool handleSurfaceInteraction(
       Project::Components::SurfaceType surface,
@@ -60,7 +71,7 @@ namespace Project::Components {
     void setRotationEnabled(bool value) { data.rotationEnabled = value; updateWorldBoxes(); }
     bool isRotationEnabled() const { return data.rotationEnabled; }
 
-    void setSolid(bool solidEnabled) { data.solid = solidEnabled; }
+    void setSolid(bool solidEnabled) { data.solid = solidEnabled; markPayloadDirty(); }
     bool isSolid() const { return data.solid; }
 
     void setRestitution(float value) { data.restitution = value; }
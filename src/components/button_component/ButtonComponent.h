@@ -33,7 +33,8 @@ namespace Project::Components {
     ~ButtonComponent() override;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::BUTTON; }
+    static constexpr ComponentType TYPE = ComponentType::BUTTON;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
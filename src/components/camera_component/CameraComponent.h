@@ -18,7 +18,8 @@ namespace Project::Components {
     ~CameraComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::CAMERA; }
+    static constexpr ComponentType TYPE = ComponentType::CAMERA;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
@@ -123,6 +123,20 @@ namespace Project::Components {
     }
   }
 
+  void GraphicsComponent::render(Project::Utilities::SpriteBatcher& batcher) {
+    SDL_Texture* textureToRender = getTextureToRender();
+    if (!textureToRender) {
+      batcher.flush();
+      render();
+      Project::Utilities::Profiler::getInstance().incrementDrawCalls();
+      return;
+    }
+
+    const SDL_Rect* src = (data.srcRect.w > 0 && data.srcRect.h > 0) ? &data.srcRect : nullptr;
+    const float angle = data.rotationEnabled ? data.rotation : 0.0f;
+    batcher.draw(textureToRender, data.blendMode, src, getRenderRect(), angle);
+  }
+
   void GraphicsComponent::build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) {
     const std::string assetName = luaStateWrapper.getTableString(tableName, Keys::ASSET_NAME, Constants::EMPTY_STRING);
     const std::string colorHex = luaStateWrapper.getTableString(tableName, Keys::COLOR_HEX, Constants::DEFAULT_SHAPE_COLOR_HEX);
@@ -202,6 +216,14 @@ namespace Project::Components {
     onAttach();
   }
 
+  void GraphicsComponent::copyFrom(const GraphicsComponent& other) {
+    data = other.data;
+    data.verticesDirty = true;
+    texture = other.texture;
+    occluder = other.occluder;
+    markPayloadDirty();
+  }
+
   void GraphicsComponent::applyStyle() {
     std::istringstream classes(getClass());
     std::string cls;
@@ -568,5 +590,6 @@ namespace Project::Components {
     boundingBox.y = static_cast<float>(data.destRect.y);
     boundingBox.w = static_cast<float>(data.destRect.w);
     boundingBox.h = static_cast<float>(data.destRect.h);
+    markPayloadDirty();
   }
 }
@@ -27,6 +27,7 @@
 #include "services/styling/StyleManager.h"
 #include "services/styling/StyleProperty.h"
 #include "utilities/logs_manager/LogsManager.h"
+#include "utilities/texture/SpriteBatcher.h"
 
 namespace Project::Components {
   class GraphicsComponent : public BaseComponent, public PositionableComponent, public TextureHolder, public Project::Interfaces::Rotatable, public Project::Interfaces::Stylable  {
@@ -35,6 +36,12 @@ namespace Project::Components {
       std::string assetPath;
       float distance2;
     };
+
+    struct Payload {
+      SDL_FRect bounds{0.0f, 0.0f, 0.0f, 0.0f};
+      bool active = false;
+      bool occluder = false;
+    };
     
     GraphicsComponent(
       SDL_Renderer* renderer,
@@ -46,11 +53,15 @@ namespace Project::Components {
     static void setCameraHandler(Project::Handlers::CameraHandler* handler);
     static Project::Handlers::CameraHandler* getCameraHandler();
     
-    ComponentType getType() const override { return ComponentType::GRAPHICS; }
+    static constexpr ComponentType TYPE = ComponentType::GRAPHICS;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
+    void render(Project::Utilities::SpriteBatcher& batcher);
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const GraphicsComponent& other);
+    bool isCloneable() const { return lodLevels.empty() && data.pendingTexturePath.empty(); }
     void applyStyle() override;
     
     void setEntityPosition(float x, float y) override;
@@ -95,8 +106,13 @@ namespace Project::Components {
     std::uint32_t getMaterialId() const { return material ? material->id : 0; }
 
     const SDL_FRect& getBoundingBox() const { return boundingBox; }
-    void setOccluder(bool value) { occluder = value; }
+    void setOccluder(bool value) { occluder = value; markPayloadDirty(); }
     bool isOccluder() const { return occluder; }
+    void writePayload(Payload& payload) const {
+      payload.bounds = boundingBox;
+      payload.active = isActive();
+      payload.occluder = occluder;
+    }
     bool isInFrustum(const Project::Handlers::Camera& cam) const;
     bool isVisible(const Project::Handlers::Camera& cam, const std::vector<SDL_FRect>& occluders,  int frame) const; 
     bool isInCameraView() const;
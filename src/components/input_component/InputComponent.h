@@ -36,7 +36,8 @@ namespace Project::Components {
     );
     ~InputComponent() override;
 
-    ComponentType getType() const override { return ComponentType::INPUT; }
+    static constexpr ComponentType TYPE = ComponentType::INPUT;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
@@ -18,7 +18,8 @@ namespace Project::Components {
     ~KeysComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::KEYS; }
+    static constexpr ComponentType TYPE = ComponentType::KEYS;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {};
@@ -60,65 +60,44 @@ namespace Project::Components {
     data.color = Project::Utilities::ColorUtils::hexToRGB(colorHex, alpha);
   }
 
+  void LightComponent::copyFrom(const LightComponent& other) {
+    data = other.data;
+  }
+
   void LightComponent::setEntityReference(Project::Entities::Entity* entity) {
     owner = entity;
     entitiesManager = entity ? entity->getEntitiesManager() : nullptr;
   }
 
   void LightComponent::castRays() {
-    endpoints.clear();
     float startAngle = Constants::ANGLE_0_DEG;
     float endAngle = Constants::ANGLE_360_DEG;
     if (data.shape == LightShape::CONE) {
       startAngle = data.direction - data.angle * Constants::DEFAULT_HALF;
       endAngle = data.direction + data.angle * Constants::DEFAULT_HALF;
     }
-    float step = (endAngle - startAngle) / static_cast<float>(data.rays);
-    for (float a = startAngle; a <= endAngle; a += step) {
-      endpoints.emplace_back(castSingleRay(a));
-    }
+
+    visibility.begin(data.position, data.radius);
+    gatherOccluders();
+    visibility.compute(startAngle, endAngle, data.rays, endpoints);
   }
 
-  SDL_FPoint LightComponent::castSingleRay(float angleDegrees) {
-    float rad = angleDegrees * Constants::DEG_TO_RAD;
-    float dx = std::cos(rad);
-    float dy = std::sin(rad);
-
-    SDL_FPoint end{data.position.x + dx * data.radius, data.position.y + dy * data.radius};
-    float closest = data.radius;
-
-    if (entitiesManager) {
-      auto& comps = entitiesManager->getComponentArray(ComponentType::BOUNDING_BOX);
-      for (auto* base : comps) {
-        auto* box = dynamic_cast<BoundingBoxComponent*>(base);
-        if (!box || !box->isActive() || !box->isSolid()) continue;
-        for (const auto& rect : box->getBoxes()) {
-          float tmin = Constants::ANGLE_0_DEG, tmax = Constants::RAYCAST_MAX_DISTANCE;
-          float p[Constants::INDEX_TWO] = {dx, dy};
-          float o[Constants::INDEX_TWO] = {data.position.x, data.position.y};
-          float minB[Constants::INDEX_TWO] = {rect.x, rect.y};
-          float maxB[Constants::INDEX_TWO] = {rect.x + rect.w, rect.y + rect.h};
-          bool hit = true;
-          for (int i = 0; i < Constants::INDEX_TWO; ++i) {
-            if (std::abs(p[i]) < Constants::RAYCAST_EPSILON) {
-              if (o[i] < minB[i] || o[i] > maxB[i]) { hit = false; break; }
-            } else {
-              float ood = Constants::DEFAULT_WHOLE / p[i];
-              float t1 = (minB[i] - o[i]) * ood;
-              float t2 = (maxB[i] - o[i]) * ood;
-              if (t1 > t2) std::swap(t1, t2);
-              if (t1 > tmin) tmin = t1;
-              if (t2 < tmax) tmax = t2;
-              if (tmin > tmax) { hit = false; break; }
-            }
-          }
-          if (hit && tmin > Constants::ANGLE_0_DEG && tmin < closest) {
-            closest = tmin;
-            end = {o[0] + p[0] * tmin, o[1] + p[1] * tmin};
-          }
-        }
+  void LightComponent::gatherOccluders() {
+    if (!entitiesManager) return;
+
+    SDL_FRect area{
+      data.position.x - data.radius,
+      data.position.y - data.radius,
+      data.radius * Constants::DEFAULT_DOUBLE,
+      data.radius * Constants::DEFAULT_DOUBLE
+    };
+
+    entitiesManager->getPhysicsSystem().getBroadPhase().query(area, [this](const Project::Utilities::Collider& collider) {
+      auto* box = collider.box;
+      if (!box || !box->isActive() || !box->isSolid()) return;
+      for (const auto& rect : box->getBoxes()) {
+        visibility.addRect(rect, box->getOwner());
       }
-    }
-    return end;
+    });
   }
-}
\ No newline at end of file
+}
@@ -8,6 +8,7 @@
 #include "components/BaseComponent.h"
 #include "components/PositionableComponent.h"
 #include "components/bounding_box_component/BoundingBoxComponent.h"
+#include "utilities/geometry/VisibilityPolygon.h"
 #include "utilities/logs_manager/LogsManager.h"
 #include "entities/EntitiesManager.h"
 
@@ -15,11 +16,13 @@ namespace Project::Components {
   class LightComponent : public BaseComponent, public PositionableComponent {
   public:
     LightComponent(SDL_Renderer* renderer, Project::Utilities::LogsManager& logsManager);
-    ComponentType getType() const override { return ComponentType::LIGHT; }
+    static constexpr ComponentType TYPE = ComponentType::LIGHT;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const LightComponent& other);
 
     void setEntityPosition(float x, float y) override { data.position = {x, y}; }
 
@@ -42,8 +45,9 @@ namespace Project::Components {
     LightData data;
     
     std::vector<SDL_FPoint> endpoints;
+    Project::Utilities::VisibilityPolygon visibility;
 
-    SDL_FPoint castSingleRay(float angleDegrees);
+    void gatherOccluders();
     void castRays();
   };
 }
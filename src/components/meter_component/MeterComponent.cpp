@@ -145,6 +145,12 @@ namespace Project::Components {
     targetName = luaStateWrapper.getTableString(tableName, Keys::TARGET, Constants::EMPTY_STRING);
   }
 
+  void MeterComponent::copyFrom(const MeterComponent& other) {
+    data = other.data;
+    numericName = other.numericName;
+    targetName = other.targetName;
+  }
+
   void MeterComponent::onAttach() {
     if (!owner) return;
     Project::Entities::Entity* target = owner;
@@ -21,11 +21,13 @@ namespace Project::Components {
     ~MeterComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::METER; }
+    static constexpr ComponentType TYPE = ComponentType::METER;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const MeterComponent& other);
     void applyStyle() override;
     void onAttach() override;
     
@@ -28,7 +28,8 @@ namespace Project::Components {
     ~ModalComponent() override;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::MODAL; }
+    static constexpr ComponentType TYPE = ComponentType::MODAL;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
@@ -130,6 +130,10 @@ namespace Project::Components {
     setRotationEnabled(rotate);
   }
 
+  void MotionComponent::copyFrom(const MotionComponent& other) {
+    data = other.data;
+  }
+
   void MotionComponent::reset() {
     data = MotionData{};
     if (owner) {
@@ -22,11 +22,13 @@ namespace Project::Components {
     ~MotionComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::MOTION; }
+    static constexpr ComponentType TYPE = ComponentType::MOTION;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const MotionComponent& other);
     void reset() override;
 
     void onAttach() override;
@@ -17,7 +17,8 @@ namespace Project::Components {
     ~NetworkComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::NETWORK; }
+    static constexpr ComponentType TYPE = ComponentType::NETWORK;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
@@ -38,6 +38,10 @@ namespace Project::Components {
     }
   }
 
+  void NumericComponent::copyFrom(const NumericComponent& other) {
+    values = other.values;
+  }
+
   void NumericComponent::setValue(const std::string& name, float value) {
     values[name].set(value);
   }
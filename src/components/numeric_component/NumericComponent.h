@@ -17,11 +17,13 @@ namespace Project::Components {
     ~NumericComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::NUMERIC; }
+    static constexpr ComponentType TYPE = ComponentType::NUMERIC;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const NumericComponent& other);
 
     void setEntityReference(Project::Entities::Entity* entity) { owner = entity; }
 
@@ -92,14 +92,24 @@ namespace Project::Components {
   }
 
   void PhysicsComponent::update(float deltaTime) {
-    auto stepUpdate = [&](float step) {
-      if (isStatic) {
-        forceX = forceY = 0.0f;
-        accelerationX = accelerationY = 0.0f;
-        return;
-      }
-      lastCollidedWithStatic = false;
+    integrate(deltaTime);
+    sweep(deltaTime);
+    finishStep(deltaTime);
+  }
 
+  void PhysicsComponent::integrate(float deltaTime) {
+    lastCollidedWithStatic = false;
+    contacted = false;
+    sweeping = false;
+
+    if (isStatic || !owner) {
+      forceX = forceY = 0.0f;
+      accelerationX = accelerationY = 0.0f;
+      if (owner) stepOrigin = stepTarget = SDL_FPoint{owner->getX(), owner->getY()};
+      return;
+    }
+
+    auto integrateStep = [&](float step) {
       if (!isKinematic && gravityEnabled) {
         const float weight = mass * Constants::GRAVITY * gravityScale;
         forceX += Constants::DEFAULT_GRAVITY_DIRECTION.x * weight;
@@ -122,45 +132,78 @@ namespace Project::Components {
       velocityX = temp.x;
       velocityY = temp.y;
 
-      if (!owner) return;
-      const float oldX = owner->getX();
-      const float oldY = owner->getY();
-      const float newX = oldX + velocityX * step;
-      const float newY = oldY + velocityY * step;
-
-      bool collisionOccurred = performContinuousCollisionDetection(newX, newY, oldX, oldY, step);
-      if (rotationEnabled) {
-        updateRotationState(step, collisionOccurred);
-      }
-
-      if (lastCollidedWithStatic && damping > 0.0f) {
-        const float factor = std::max(0.0f, Constants::DEFAULT_WHOLE - damping * step);
-        velocityX *= factor;
-        velocityY *= factor;
-        if (std::abs(velocityX) < Constants::DEFAULT_COLLISION_THRESHOLD) velocityX = 0.0f;
-        if (std::abs(velocityY) < Constants::DEFAULT_COLLISION_THRESHOLD) velocityY = 0.0f;
-      }
+      stepTarget.x += velocityX * step;
+      stepTarget.y += velocityY * step;
 
       forceX = forceY = 0.0f;
       accelerationX = accelerationY = 0.0f;
     };
 
+    stepOrigin = SDL_FPoint{owner->getX(), owner->getY()};
+    stepTarget = stepOrigin;
+
     if (data.tickRate > 0.0f) {
       data.tickAccumulator += deltaTime;
       while (data.tickAccumulator >= data.tickRate) {
-        float step = data.tickRate;
         data.tickAccumulator -= data.tickRate;
-        stepUpdate(step);
+        integrateStep(data.tickRate);
       }
       if (data.tickAccumulator > 0.0f) {
-        float step = data.tickAccumulator;
-        stepUpdate(step);
+        integrateStep(data.tickAccumulator);
         data.tickAccumulator = 0.0f;
       }
-      return;
+    } else {
+      integrateStep(deltaTime);
     }
 
-    stepUpdate(deltaTime);
+    const float travel = std::max(std::abs(stepTarget.x - stepOrigin.x), std::abs(stepTarget.y - stepOrigin.y));
+    sweeping = travel > Constants::DEFAULT_CELL_SIZE;
+    if (!sweeping) {
+      syncPositionWithComponents(stepTarget.x, stepTarget.y);
+    }
+  }
+
+  bool PhysicsComponent::sweep(float deltaTime) {
+    if (isStatic || !owner) return false;
+    const bool collided = performContinuousCollisionDetection(stepTarget.x, stepTarget.y, stepOrigin.x, stepOrigin.y, deltaTime);
+    if (collided) contacted = true;
+    return collided;
+  }
+
+  bool PhysicsComponent::resolveContact(const Project::Utilities::Collider& other, const SDL_FPoint& offset) {
+    auto* myBox = owner ? owner->getBoundingBoxComponent() : nullptr;
+    if (!myBox || !other.box) return false;
+
+    auto* entity = other.physics ? other.physics->getOwner() : other.entity;
+    if (!handleCollision(myBox, other.box, other.physics, entity, offset, owner->getX(), owner->getY())) {
+      return false;
+    }
+
+    contacted = true;
+    if (other.physics) other.physics->contacted = true;
+
+    if (other.physics && !other.physics->getStatic()) {
+      const float bounce = (myBox->getRestitution() + other.box->getRestitution()) * Constants::DEFAULT_HALF;
+      const float fric = (myBox->getFriction() + other.box->getFriction()) * Constants::DEFAULT_HALF;
+      other.physics->handleSelfSurface(other.box, SDL_FPoint{-offset.x, -offset.y}, bounce, fric);
+    }
+    return true;
+  }
+
+  void PhysicsComponent::finishStep(float deltaTime) {
+    if (isStatic || !owner) return;
+
+    if (rotationEnabled) {
+      updateRotationState(deltaTime, contacted);
+    }
+
+    if (lastCollidedWithStatic && damping > 0.0f) {
+      const float factor = std::max(0.0f, Constants::DEFAULT_WHOLE - damping * deltaTime);
+      velocityX *= factor;
+      velocityY *= factor;
+      if (std::abs(velocityX) < Constants::DEFAULT_COLLISION_THRESHOLD) velocityX = 0.0f;
+      if (std::abs(velocityY) < Constants::DEFAULT_COLLISION_THRESHOLD) velocityY = 0.0f;
+    }
   }
 
   void PhysicsComponent::build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) {
@@ -195,6 +238,10 @@ namespace Project::Components {
     setKinematic(kine);
   }
 
+  void PhysicsComponent::copyFrom(const PhysicsComponent& other) {
+    data = other.data;
+  }
+
   SDL_FRect PhysicsComponent::unionRect(const SDL_FRect& a, const SDL_FRect& b) const {
     const float left = std::min(a.x, b.x);
     const float top = std::min(a.y, b.y);
@@ -203,14 +250,12 @@ namespace Project::Components {
     return {left, top, right - left, bottom - top};
   }
 
-  bool PhysicsComponent::checkBoxBoxCollisions(
+  bool PhysicsComponent::findBoxBoxContact(
     const std::vector<SDL_FRect>& myRects, const std::vector<SDL_FRect>& otherRects,
     const std::vector<Project::Utilities::OrientedBox>& myOBB,
     const std::vector<Project::Utilities::OrientedBox>& otherOBB,
     bool myRotationEnabled, bool otherRotationEnabled,
-    BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox,
-    PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-    float newX, float newY, float velocityDeltaX, float velocityDeltaY) {
+    float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const {
 
     auto rectToOBB = [](const SDL_FRect& r) {
       Project::Utilities::OrientedBox obb;
@@ -237,7 +282,6 @@ namespace Project::Components {
         }
 
         if (collides) {
-          SDL_FPoint offset;
           if (myRotationEnabled || otherRotationEnabled) {
             auto oA = myRotationEnabled ? myOBB[i] : rectToOBB(myRects[i]);
             auto oB = otherRotationEnabled ? otherOBB[j] : rectToOBB(otherRects[j]);
@@ -245,62 +289,53 @@ namespace Project::Components {
           } else {
             offset = PhysicsUtils::getSnapOffset(myRects[i], otherRects[j], velocityDeltaX, velocityDeltaY);
           }
-          
-          return handleCollision(
-            myBox, otherBox, otherPhysics, entity, offset, newX, newY
-          );
+          return true;
         }
       }
     }
     return false;
   }
 
-  bool PhysicsComponent::checkBoxCircleCollisions(
+  bool PhysicsComponent::findBoxCircleContact(
     const std::vector<SDL_FRect>& myRects, const std::vector<Project::Utilities::Circle>& otherCircles,
-    BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox,
-    PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-    float newX, float newY, float velocityDeltaX, float velocityDeltaY) {
+    float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const {
     
     for (const auto& rect : myRects) {
       for (const auto& circle : otherCircles) {
         if (PhysicsUtils::checkCollision(rect, circle)) {
-          const SDL_FPoint offset = PhysicsUtils::getRectCircleSnapOffset(rect, circle, velocityDeltaX, velocityDeltaY);
-          return handleCollision(myBox, otherBox, otherPhysics, entity, offset, newX, newY);
+          offset = PhysicsUtils::getRectCircleSnapOffset(rect, circle, velocityDeltaX, velocityDeltaY);
+          return true;
         }
       }
     }
     return false;
   }
 
-  bool PhysicsComponent::checkCircleCircleCollisions(
+  bool PhysicsComponent::findCircleCircleContact(
     const std::vector<Project::Utilities::Circle>& myCircles, 
     const std::vector<Project::Utilities::Circle>& otherCircles,
-    BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox,
-    PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-    float newX, float newY, float velocityDeltaX, float velocityDeltaY) {
+    float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const {
     
     for (const auto& c1 : myCircles) {
       for (const auto& c2 : otherCircles) {
         if (PhysicsUtils::checkCollision(c1, c2)) {
-          const SDL_FPoint offset = PhysicsUtils::getCircleSnapOffset(c1, c2, velocityDeltaX, velocityDeltaY);
-          return handleCollision(myBox, otherBox, otherPhysics, entity, offset, newX, newY);
+          offset = PhysicsUtils::getCircleSnapOffset(c1, c2, velocityDeltaX, velocityDeltaY);
+          return true;
         }
       }
     }
     return false;
   }
 
-  bool PhysicsComponent::checkCircleBoxCollisions(
+  bool PhysicsComponent::findCircleBoxContact(
     const std::vector<Project::Utilities::Circle>& myCircles, const std::vector<SDL_FRect>& otherRects,
-    BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox,
-    PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-    float newX, float newY, float velocityDeltaX, float velocityDeltaY) {
+    float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const {
     
     for (const auto& circle : myCircles) {
       for (const auto& rect : otherRects) {
         if (PhysicsUtils::checkCollision(rect, circle)) {
-          const SDL_FPoint offset = PhysicsUtils::getCircleRectSnapOffset(circle, rect, velocityDeltaX, velocityDeltaY);
-          return handleCollision(myBox, otherBox, otherPhysics, entity, offset, newX, newY);
+          offset = PhysicsUtils::getCircleRectSnapOffset(circle, rect, velocityDeltaX, velocityDeltaY);
+          return true;
         }
       }
     }
@@ -350,18 +385,7 @@ namespace Project::Components {
         }
       }
 
-      if (myBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT) {
-        myBox->handleSurfaceInteraction(
-          SurfaceType::DESTROY_ON_HIT,
-          owner,
-          offset,
-          bounce,
-          fric,
-          velocityX,
-          velocityY
-        );
-      }
-      
+      handleSelfSurface(myBox, offset, bounce, fric);
       return true;
     }
 
@@ -439,19 +463,62 @@ namespace Project::Components {
       lastCollidedWithStatic = true;
     }
 
-    if (myBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT) {
-      myBox->handleSurfaceInteraction(
-        SurfaceType::DESTROY_ON_HIT,
-        owner,
-        offset,
-        bounce,
-        fric,
-        velocityX,
-        velocityY
-      );
+    handleSelfSurface(myBox, offset, bounce, fric);
+    return true;
+  }
+
+  void PhysicsComponent::handleSelfSurface(BoundingBoxComponent* myBox, const SDL_FPoint& offset, float bounce, float fric) {
+    if (myBox->getSurfaceType() != SurfaceType::DESTROY_ON_HIT) return;
+    myBox->handleSurfaceInteraction(SurfaceType::DESTROY_ON_HIT, owner, offset, bounce, fric, velocityX, velocityY);
+  }
+
+  bool PhysicsComponent::findContact(
+    const Project::Utilities::Collider& other,
+    float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const {
+    auto* myBox = owner ? owner->getBoundingBoxComponent() : nullptr;
+    if (!myBox || !myBox->isInteractive()) return false;
+
+    auto* candidate = other.physics;
+    if (candidate == this) return false;
+    auto* entity = candidate ? candidate->getOwner() : other.entity;
+    auto* otherBox = other.box;
+    if (!entity || !otherBox || otherBox == myBox) return false;
+    
+    if (myBox->isIgnoring(entity->getEntityName())) return false;
+    if (otherBox->isIgnoring(owner->getEntityName())) return false;
+
+    if (!otherBox->isInteractive()) return false;
+    if (myBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT &&
+        otherBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT) {
+      return false;
     }
 
-    return true;
+    if (!broadPhaseCollisionCheck(myBox, otherBox)) {
+      return false;
+    }
+
+    std::vector<SDL_FRect> myProxyRects;
+    std::vector<SDL_FRect> otherProxyRects;
+    static const std::vector<Project::Utilities::Circle> emptyCircles;
+    static const std::vector<Project::Utilities::OrientedBox> emptyOBB;
+
+    const auto& myRects = myBox->usesProxy() ? (myProxyRects.push_back(myBox->getProxyAABB()), myProxyRects) : myBox->getBoxes();
+    const auto& myCircles = myBox->usesProxy() ? emptyCircles : myBox->getCircles();
+    const auto& myOBB = myBox->usesProxy() ? emptyOBB : myBox->getOrientedBoxes();
+    const bool myRotationEnabled = myBox->usesProxy() ? false : myBox->isRotationEnabled();
+
+    const auto& otherRects = otherBox->usesProxy() ? (otherProxyRects.push_back(otherBox->getProxyAABB()), otherProxyRects) : otherBox->getBoxes();
+    const auto& otherCircles = otherBox->usesProxy() ? emptyCircles : otherBox->getCircles();
+    const auto& otherOBB = otherBox->usesProxy() ? emptyOBB : otherBox->getOrientedBoxes();
+    const bool otherRotationEnabled = otherBox->usesProxy() ? false : otherBox->isRotationEnabled();
+
+    return findBoxBoxContact(
+        myRects, otherRects, myOBB, otherOBB,
+        myRotationEnabled, otherRotationEnabled,
+        velocityDeltaX, velocityDeltaY, offset) ||
+      findBoxCircleContact(myRects, otherCircles, velocityDeltaX, velocityDeltaY, offset) ||
+      findCircleCircleContact(myCircles, otherCircles, velocityDeltaX, velocityDeltaY, offset) ||
+      findCircleBoxContact(myCircles, otherRects, velocityDeltaX, velocityDeltaY, offset);
   }
 
   bool PhysicsComponent::performCollisionDetection(float newX, float newY, float oldX, float oldY, float deltaTime) {
@@ -466,30 +533,17 @@ namespace Project::Components {
     const float velocityDeltaX = velocityX * deltaTime;
     const float velocityDeltaY = velocityY * deltaTime;
 
-    // const auto& myRects = myBox->getBoxes();
-    // const auto& myCircles = myBox->getCircles();
-    // const auto& myOBB = myBox->getOrientedBoxes();
-    // const bool myRotationEnabled = myBox->isRotationEnabled();   
-    std::vector<SDL_FRect> myProxyRects;
-    std::vector<Project::Utilities::Circle> emptyCircles;
-    std::vector<Project::Utilities::OrientedBox> emptyOBB;
-    const auto& myRects = myBox->usesProxy() ? (myProxyRects.push_back(myBox->getProxyAABB()), myProxyRects) : myBox->getBoxes();
-    const auto& myCircles = myBox->usesProxy() ? emptyCircles : myBox->getCircles();
-    const auto& myOBB = myBox->usesProxy() ? emptyOBB : myBox->getOrientedBoxes();
-    const bool myRotationEnabled = myBox->usesProxy() ? false : myBox->isRotationEnabled();
-
     SDL_FRect myBounds{0.f, 0.f, 0.f, 0.f};
     if (!computeBounds(myBox, myBounds)) {
       myBounds = SDL_FRect{newX, newY, 0.f, 0.f};
     }
 
     auto& physSystem = manager->getPhysicsSystem();
-    auto& bvh = physSystem.getBVH();
-    // auto& quadtree = physSystem.getQuadTree();
+    const auto& broadPhase = physSystem.getBroadPhase();
     auto queryStart = std::chrono::high_resolution_clock::now();
    
-    auto candidates = bvh.query(myBounds);
-    // auto candidates = quadtree.query(myBounds);
+    thread_local std::vector<Project::Utilities::Collider> candidates;
+    broadPhase.query(myBounds, candidates);
     auto queryEnd = std::chrono::high_resolution_clock::now();
     physSystem.recordSpatialQuery(std::chrono::duration<float, std::milli>(queryEnd - queryStart).count());
 
@@ -506,72 +560,14 @@ namespace Project::Components {
       }), candidates.end());
 
     for (const auto& coll : candidates) {
-      auto* candidate = coll.physics;
-      if (candidate == this) continue;
-      auto* entity = candidate ? candidate->getOwner() : coll.entity;
-      auto* otherBox = coll.box;
-      if (!entity || !otherBox) continue;
-      
-      if (myBox->isIgnoring(entity->getEntityName())) continue;
-      if (otherBox->isIgnoring(owner->getEntityName())) continue;
-
-      if (!otherBox->isInteractive()) continue;
-      if (myBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT &&
-          otherBox->getSurfaceType() == SurfaceType::DESTROY_ON_HIT) {
-        continue;
-      }
-
-      // const auto& otherRects = otherBox->getBoxes();
-      // const auto& otherCircles = otherBox->getCircles();
-      // const auto& otherOBB = otherBox->getOrientedBoxes();
-      // const bool otherRotationEnabled = otherBox->isRotationEnabled();
-      std::vector<SDL_FRect> otherProxyRects;
-      std::vector<Project::Utilities::Circle> otherEmptyCircles;
-      std::vector<Project::Utilities::OrientedBox> otherEmptyOBB;
-      const auto& otherRects = otherBox->usesProxy() ? (otherProxyRects.push_back(otherBox->getProxyAABB()), otherProxyRects) : otherBox->getBoxes();
-      const auto& otherCircles = otherBox->usesProxy() ? otherEmptyCircles : otherBox->getCircles();
-      const auto& otherOBB = otherBox->usesProxy() ? otherEmptyOBB : otherBox->getOrientedBoxes();
-      const bool otherRotationEnabled = otherBox->usesProxy() ? false : otherBox->isRotationEnabled();
-      
-      if (!broadPhaseCollisionCheck(myBox, otherBox)) {
-        continue;
-      }
-
-      auto* otherPhysics = candidate;
-      if (checkBoxBoxCollisions(
-        myRects, otherRects, myOBB, otherOBB, 
-        myRotationEnabled, otherRotationEnabled,
-        myBox, otherBox, otherPhysics, entity,
-        newX, newY, velocityDeltaX, velocityDeltaY)
-      ) {
-        collisionOccurred = true;
-        if (shouldExitEarly()) break;
-      }
-
-      if (checkBoxCircleCollisions(
-        myRects, otherCircles,
-        myBox, otherBox, otherPhysics, entity,
-        newX, newY, velocityDeltaX, velocityDeltaY)
-      ) {
-        collisionOccurred = true;
-        if (shouldExitEarly()) break;
-      }
-
-      if (checkCircleCircleCollisions(
-        myCircles, otherCircles, 
-        myBox, otherBox, otherPhysics, entity,
-        newX, newY, velocityDeltaX, velocityDeltaY)
-      ) {
-        collisionOccurred = true;
-        if (shouldExitEarly()) break;
-      }
+      SDL_FPoint offset{0.f, 0.f};
+      if (!findContact(coll, velocityDeltaX, velocityDeltaY, offset)) continue;
 
-      if (checkCircleBoxCollisions(
-        myCircles, otherRects, 
-        myBox, otherBox, otherPhysics, entity,
-        newX, newY, velocityDeltaX, velocityDeltaY)
-      ) {
+      auto* entity = coll.physics ? coll.physics->getOwner() : coll.entity;
+      physSystem.recordContact(owner, entity);
+      if (handleCollision(myBox, coll.box, coll.physics, entity, offset, newX, newY)) {
         collisionOccurred = true;
+        if (coll.physics) coll.physics->contacted = true;
         if (shouldExitEarly()) break;
       }
     }
@@ -601,7 +597,7 @@ namespace Project::Components {
     return collided;
   }
 
-  bool PhysicsComponent::broadPhaseCollisionCheck(BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox) {
+  bool PhysicsComponent::broadPhaseCollisionCheck(BoundingBoxComponent* myBox, BoundingBoxComponent* otherBox) const {
     SDL_FRect myBounds{0.f, 0.f, 0.f, 0.f};
     SDL_FRect otherBounds{0.f, 0.f, 0.f ,0.f};
 
@@ -686,7 +682,7 @@ namespace Project::Components {
     return hasBounds;
   }
 
-  bool PhysicsComponent::shouldExitEarly() {
+  bool PhysicsComponent::shouldExitEarly() const {
     return std::abs(velocityX) < 0.1f && std::abs(velocityY) < 0.1f;
   }
 
@@ -14,6 +14,10 @@ namespace Project::Components {
   class BoundingBoxComponent;
 }
 
+namespace Project::Utilities {
+  struct Collider;
+}
+
 namespace Project::Components {
 
   class PhysicsComponent : public BaseComponent {
@@ -23,13 +27,23 @@ namespace Project::Components {
     ~PhysicsComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::PHYSICS; }
+    static constexpr ComponentType TYPE = ComponentType::PHYSICS;
+    ComponentType getType() const override { return TYPE; }
 
     void resolveCollisionWith(PhysicsComponent* other, float restitution);
 
     void update(float deltaTime) override;
+    void integrate(float deltaTime);
+    bool sweep(float deltaTime);
+    void finishStep(float deltaTime);
+    bool requiresSweep() const { return sweeping; }
+    bool hasContacted() const { return contacted; }
+
+    bool findContact(const Project::Utilities::Collider& other, float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset) const;
+    bool resolveContact(const Project::Utilities::Collider& other, const SDL_FPoint& offset);
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const PhysicsComponent& other);
 
     void setEntityReference(Project::Entities::Entity* entity) { owner = entity; }
 
@@ -132,44 +146,37 @@ namespace Project::Components {
     bool& isStatic = data.isStatic;
     bool& isKinematic = data.isKinematic;
     bool lastCollidedWithStatic = false;
+    bool sweeping = false;
+    bool contacted = false;
+
+    SDL_FPoint stepOrigin{0.f, 0.f};
+    SDL_FPoint stepTarget{0.f, 0.f};
 
     SDL_FRect unionRect(const SDL_FRect& a, const SDL_FRect& b) const;
 
-    bool checkBoxBoxCollisions(
+    bool findBoxBoxContact(
       const std::vector<SDL_FRect>& myRects, const std::vector<SDL_FRect>& otherRects,
       const std::vector<Project::Utilities::OrientedBox>& myOBB, 
       const std::vector<Project::Utilities::OrientedBox>& otherOBB,
       bool myRotationEnabled, bool otherRotationEnabled,
-      Project::Components::BoundingBoxComponent* myBox,
-      Project::Components::BoundingBoxComponent* otherBox,
-      PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-      float newX, float newY, float velocityDeltaX, float velocityDeltaY
-    );
+      float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset
+    ) const;
 
-    bool checkBoxCircleCollisions(
+    bool findBoxCircleContact(
       const std::vector<SDL_FRect>& myRects, const std::vector<Project::Utilities::Circle>& otherCircles,
-      Project::Components::BoundingBoxComponent* myBox,
-      Project::Components::BoundingBoxComponent* otherBox,
-      PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-      float newX, float newY, float velocityDeltaX, float velocityDeltaY
-    );
+      float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset
+    ) const;
     
-    bool checkCircleCircleCollisions(
+    bool findCircleCircleContact(
       const std::vector<Project::Utilities::Circle>& myCircles, 
       const std::vector<Project::Utilities::Circle>& otherCircles,
-      Project::Components::BoundingBoxComponent* myBox,
-      Project::Components::BoundingBoxComponent* otherBox,
-      PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-      float newX, float newY, float velocityDeltaX, float velocityDeltaY
-    );
+      float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset
+    ) const;
     
-    bool checkCircleBoxCollisions(    
+    bool findCircleBoxContact(
       const std::vector<Project::Utilities::Circle>& myCircles, const std::vector<SDL_FRect>& otherRects,
-      Project::Components::BoundingBoxComponent* myBox,
-      Project::Components::BoundingBoxComponent* otherBox,
-      PhysicsComponent* otherPhysics, Project::Entities::Entity* entity,
-      float newX, float newY, float velocityDeltaX, float velocityDeltaY
-    );
+      float velocityDeltaX, float velocityDeltaY, SDL_FPoint& offset
+    ) const;
 
     bool handleCollision(
       Project::Components::BoundingBoxComponent* myBox,
@@ -186,15 +193,16 @@ namespace Project::Components {
       const SDL_FPoint& offset, float newX, float newY
     );
 
+    void handleSelfSurface(Project::Components::BoundingBoxComponent* myBox, const SDL_FPoint& offset, float bounce, float fric);
 
     bool performCollisionDetection(float newX, float newY, float oldX, float oldY, float deltaTime);
     bool broadPhaseCollisionCheck(
       Project::Components::BoundingBoxComponent* myBox, 
       Project::Components::BoundingBoxComponent* otherBox
-    );
+    ) const;
 
     bool computeBounds(Project::Components::BoundingBoxComponent* box, SDL_FRect& bounds) const;
-    bool shouldExitEarly();
+    bool shouldExitEarly() const;
     
     void applyFriction(float fric);
     void syncPositionWithComponents(float x, float y);
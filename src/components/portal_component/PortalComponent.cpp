@@ -50,6 +50,10 @@ namespace Project::Components {
     data.animation = luaStateWrapper.getTableString(tableName, Keys::ANIMATION, Project::Libraries::Constants::EMPTY_STRING);
   }
 
+  void PortalComponent::copyFrom(const PortalComponent& other) {
+    data = other.data;
+  }
+
   void PortalComponent::trigger(Project::Entities::Entity* entity) {
     if (!isActive() || !entity || !data.triggerOnAction) return;
     beginTeleport(entity);
@@ -67,14 +71,9 @@ namespace Project::Components {
 
     auto* manager = owner->getEntitiesManager();
     if (!manager) return;
-    auto entities = manager->filterEntitiesByComponents({ComponentType::BOUNDING_BOX});
-    for (auto* ent : entities) {
-      if (!ent || ent == owner) continue;
-      auto* bbox = ent->getBoundingBoxComponent();
-      if (!bbox) continue;
-      const auto& boxes = bbox->getBoxes();
-      if (boxes.empty()) continue;
-      SDL_FRect rect = boxes.front();
+    for (auto [ent, bbox] : manager->payloadQuery<BoundingBoxComponent>()) {
+      if (!ent || ent == owner || !bbox->hasBounds) continue;
+      SDL_FRect rect = bbox->bounds;
       bool inside = rect.x >= portalRect.x && rect.y >= portalRect.y &&
         rect.x + rect.w <= portalRect.x + portalRect.w &&
         rect.y + rect.h <= portalRect.y + portalRect.h;
@@ -15,11 +15,13 @@ namespace Project::Components {
     ~PortalComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::PORTAL; }
+    static constexpr ComponentType TYPE = ComponentType::PORTAL;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const PortalComponent& other);
 
     void setEntityReference(Project::Entities::Entity* entity) { owner = entity; }
     void setTarget(float x, float y) { data.targetX = x; data.targetY = y; }
@@ -34,6 +34,10 @@ namespace Project::Components {
     data.rate = static_cast<float>(luaStateWrapper.getTableNumber(tableName, Keys::RATE, data.rate));
   }
 
+  void SpawnerComponent::copyFrom(const SpawnerComponent& other) {
+    data = other.data;
+  }
+
   void SpawnerComponent::spawn(float _offsetX, float _offsetY, float _velocityX, float _velocityY, float _rotation) {
     if (!owner || !data.canSpawn()) return;
     
@@ -75,7 +79,7 @@ namespace Project::Components {
     }
 
     std::shared_ptr<Entity> shared = std::move(ent);
-    manager->addEntity(shared);
+    manager->queueAddEntity(shared);
     data.resetCooldown();
   }
 
@@ -16,11 +16,13 @@ namespace Project::Components {
     ~SpawnerComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::SPAWNER; }
+    static constexpr ComponentType TYPE = ComponentType::SPAWNER;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const SpawnerComponent& other);
 
     void setEntityReference(Project::Entities::Entity* entity);
     void setTemplate(const std::string& _name) { data.templateName = _name; }
@@ -25,7 +25,8 @@ namespace Project::Components {
     TextComponent(SDL_Renderer* renderer, Project::Utilities::ConfigReader& configReader, Project::Utilities::LogsManager& logsManager);
     ~TextComponent() override;
 
-    ComponentType getType() const override { return ComponentType::TEXT; }
+    static constexpr ComponentType TYPE = ComponentType::TEXT;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override;
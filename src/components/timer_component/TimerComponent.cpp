@@ -36,6 +36,10 @@ namespace Project::Components {
     data.repeat = luaStateWrapper.getTableBoolean(tableName, Keys::REPEAT, false);
   }
 
+  void TimerComponent::copyFrom(const TimerComponent& other) {
+    data = other.data;
+  }
+
   void TimerComponent::stop() {
     setActive(false);
     data.reset();
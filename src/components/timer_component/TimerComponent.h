@@ -18,11 +18,13 @@ namespace Project::Components {
     ~TimerComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::TIMER; }
+    static constexpr ComponentType TYPE = ComponentType::TIMER;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const TimerComponent& other);
 
     void stop();
     void reset() { data.elapsed = 0.0f; }
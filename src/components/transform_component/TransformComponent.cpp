@@ -60,6 +60,10 @@ namespace Project::Components {
     data.allowRevert = luaStateWrapper.getTableBoolean(tableName, Keys::ALLOW_REVERT, true);
   }
 
+  void TransformComponent::copyFrom(const TransformComponent& other) {
+    data = other.data;
+  }
+
   void TransformComponent::reset() {
     data = TransformData{};
   }
@@ -21,11 +21,13 @@ namespace Project::Components {
     ~TransformComponent() override = default;
 
     Project::Entities::Entity* getOwner() const override { return owner; }
-    ComponentType getType() const override { return ComponentType::TRANSFORM; }
+    static constexpr ComponentType TYPE = ComponentType::TRANSFORM;
+    ComponentType getType() const override { return TYPE; }
 
     void update(float deltaTime) override;
     void render() override {}
     void build(Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName) override;
+    void copyFrom(const TransformComponent& other);
     void reset() override;
 
     void setEntityReference(Project::Entities::Entity* entity) { owner = entity; }
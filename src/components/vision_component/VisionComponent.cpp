@@ -3,7 +3,6 @@
 #include <algorithm>
 #include <cmath>
 #include <string>
-#include <unordered_set>
 
 #include "libraries/constants/Constants.h"
 #include "libraries/keys/Keys.h"
@@ -216,93 +215,43 @@ namespace Project::Components {
     }
   }
 
-  std::pair<SDL_FPoint, Project::Entities::Entity*> VisionComponent::castSingleRay(float angleDegrees) {
+  void VisionComponent::gatherOccluders() {
     using namespace Project::Libraries::Constants;
-    float rad = angleDegrees * DEG_TO_RAD;
-    float dx = std::cos(rad);
-    float dy = std::sin(rad);
+    if (!entitiesManager) return;
 
-    SDL_FPoint end{data.position.x + dx * data.radius, data.position.y + dy * data.radius};
-    float closest = data.radius;
-    Project::Entities::Entity* hitEntity = nullptr;
-
-    if (!entitiesManager) return {end, nullptr};
-
-    float origin[2] = {data.position.x, data.position.y};
-    float dir[2] = {dx, dy};
+    SDL_FRect area{
+      data.position.x - data.radius,
+      data.position.y - data.radius,
+      data.radius * DEFAULT_DOUBLE,
+      data.radius * DEFAULT_DOUBLE
+    };
 
-    for (auto* base : entitiesManager->getComponentArray(ComponentType::BOUNDING_BOX)) {
-      auto* box = dynamic_cast<BoundingBoxComponent*>(base);
-      if (!box || !box->isActive() || !box->isSolid()) continue;
+    entitiesManager->getPhysicsSystem().getBroadPhase().query(area, [this](const Project::Utilities::Collider& collider) {
+      auto* box = collider.box;
+      if (!box || !box->isActive() || !box->isSolid()) return;
       for (const auto& rect : box->getBoxes()) {
-        float t;
-        if (rayIntersectsAABB(origin, dir, rect, t) &&
-            t > ANGLE_0_DEG && t < closest) {
-          closest = t;
-          end = {origin[0] + dir[0] * t, origin[1] + dir[1] * t};
-          hitEntity = box->getOwner();
-        }
+        visibility.addRect(rect, box->getOwner());
       }
-    }
-
-    for (auto* base : entitiesManager->getComponentArray(ComponentType::GRAPHICS)) {
-      auto* gfx = dynamic_cast<GraphicsComponent*>(base);
-      if (!gfx || !gfx->isActive() || !gfx->isOccluder() || gfx->getOwner() == owner) continue;
-      float t;
-      if (rayIntersectsAABB(origin, dir, gfx->getBoundingBox(), t) &&
-          t > ANGLE_0_DEG && t < closest) {
-        closest = t;
-        end = {origin[0] + dir[0] * t, origin[1] + dir[1] * t};
-        hitEntity = gfx->getOwner();
-      }
-    }
+    });
 
-    return {end, hitEntity};
-  }
-
-  bool VisionComponent::rayIntersectsAABB(const float origin[2], const float dir[2], const SDL_FRect& rect, float& outT) const {
-    using namespace Project::Libraries::Constants;
-    float tmin = ANGLE_0_DEG;
-    float tmax = RAYCAST_MAX_DISTANCE;
-
-    float minB[2] = {rect.x, rect.y};
-    float maxB[2] = {rect.x + rect.w, rect.y + rect.h};
-
-    for (int i = 0; i < INDEX_TWO; ++i) {
-      if (std::abs(dir[i]) < RAYCAST_EPSILON) {
-        if (origin[i] < minB[i] || origin[i] > maxB[i]) return false;
-      } else {
-        float ood = DEFAULT_WHOLE / dir[i];
-        float t1 = (minB[i] - origin[i]) * ood;
-        float t2 = (maxB[i] - origin[i]) * ood;
-        if (t1 > t2) std::swap(t1, t2);
-        if (t1 > tmin) tmin = t1;
-        if (t2 < tmax) tmax = t2;
-        if (tmin > tmax) return false;
-      }
+    for (auto [gfxOwner, gfx] : entitiesManager->payloadQuery<GraphicsComponent>()) {
+      if (!gfx->active || !gfx->occluder || gfxOwner == owner) continue;
+      visibility.addRect(gfx->bounds, gfxOwner);
     }
-
-    outT = tmin;
-    return true;
   }
 
   void VisionComponent::castRays() {
     using namespace Project::Libraries::Constants;
-    endpoints.clear();
-    visibleEntities.clear();
     float startAngle = ANGLE_0_DEG;
     float endAngle = ANGLE_360_DEG;
     if (data.shape == VisionShape::CONE) {
       startAngle = data.direction - data.angle * DEFAULT_HALF;
       endAngle = data.direction + data.angle * DEFAULT_HALF;
     }
-    float step = (endAngle - startAngle) / static_cast<float>(data.rays);
-    std::unordered_set<Project::Entities::Entity*> unique;
-    for (float a = startAngle; a <= endAngle; a += step) {
-      auto [pt, hit] = castSingleRay(a);
-      endpoints.emplace_back(pt);
-      if (hit && hit != owner) unique.insert(hit);
-    }
-    visibleEntities.assign(unique.begin(), unique.end());
+
+    visibility.begin(data.position, data.radius);
+    gatherOccluders();
+    visibility.compute(startAngle, endAngle, data.rays, endpoints, &visibleEntities);
+    visibleEntities.erase(std::remove(visibleEntities.begin(), visibleEntities.end(), owner), visibleEntities.end());
   }
 }
@@ -11,13 +11,15 @@
 #include "handlers/camera/CameraHandler.h"
 #include "interfaces/rotation_interface/Rotatable.h"
 #include "entities/EntitiesManager.h"
+#include "utilities/geometry/VisibilityPolygon.h"
 #include "utilities/logs_manager/LogsManager.h"
 
 namespace Project::Components {
   class VisionComponent : public BaseComponent, public PositionableComponent, public Project::Interfaces::Rotatable {
   public:
     VisionComponent(SDL_Renderer* renderer, Project::Utilities::LogsManager& logsManager);
-    ComponentType getType() const override { return ComponentType::VISION; }
+    static constexpr ComponentType TYPE = ComponentType::VISION;
+    ComponentType getType() const override { return TYPE; }
     static void setCameraHandler(Project::Handlers::CameraHandler* handler);
 
     void update(float deltaTime) override;
@@ -57,9 +59,9 @@ namespace Project::Components {
     std::vector<Project::Entities::Entity*> visibleEntities;
     SDL_FPoint positionOffset{0.f, 0.f};
     float darknessAlpha{0.f};
+    Project::Utilities::VisibilityPolygon visibility;
 
-    std::pair<SDL_FPoint, Project::Entities::Entity*> castSingleRay(float angleDegrees);
-    bool rayIntersectsAABB(const float origin[2], const float dir[2], const SDL_FRect& rect, float& outT) const;
+    void gatherOccluders();
     void castRays();
   };
 }
@@ -2,15 +2,20 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <string>
 #include <thread>
 
+#include "entities/EntitiesManager.h"
 #include "helpers/null_checker/NullChecker.h"
 #include "libraries/constants/Constants.h"
 #include "libraries/keys/Keys.h"
+#include "libraries/modes/BroadPhaseModes.h"
 #include "platform/renderer/OpenGLRenderer.h"
 #include "platform/renderer/VulkanRenderer.h"
 #include "utilities/exception/EngineException.h"
 #include "utilities/profiler/Profiler.h"
+#include "utilities/spatial/BroadPhaseTypeResolver.h"
 #include "utilities/thread/ThreadPool.h"
 
 namespace Project::Core {
@@ -33,7 +38,8 @@ namespace Project::Core {
   namespace Keys = Project::Libraries::Keys;
 
   GameEngine::GameEngine() :
-  isRunning(false), maxFPS(Constants::DEFAULT_MAX_FPS), entityLoadFactor(Constants::DEFAULT_WHOLE), frameTimeAvg(0.0),
+  entityLoadFactor(Constants::DEFAULT_WHOLE), frameTimeAvg(0.0), maxFPS(Constants::DEFAULT_MAX_FPS),
+  headlessTickRate(Constants::TARGET_FPS), headlessMaxTicks(0), isRunning(false), headless(false), headlessUnlocked(false),
   framesCounter(), logsManager(), configReader(logsManager),
   platform(std::make_unique<SDLPlatform>(logsManager)),
   resourcesHandler(std::make_unique<ResourcesHandler>(logsManager)),
@@ -66,6 +72,19 @@ namespace Project::Core {
     }
   }
 
+  void GameEngine::parseArguments(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      if (arg == Keys::ARG_HEADLESS) {
+        headless = true;
+      } else if (arg == Keys::ARG_UNLOCKED) {
+        headlessUnlocked = true;
+      } else if (arg == Keys::ARG_TICKS && i + 1 < argc) {
+        headlessMaxTicks = std::max(0LL, std::atoll(argv[++i]));
+      }
+    }
+  }
+
   void GameEngine::init() {
     try {
       if (logsManager.checkAndLogError(!configReader.loadConfig(Keys::CONFIG_FILE), "Failed to load config.ini")) {
@@ -76,6 +95,13 @@ namespace Project::Core {
         componentsFactory->configurePools();
       }
 
+      Project::Utilities::Profiler::getInstance().setEnabled(
+        configReader.getBoolValue(Keys::PROFILER_SECTION, Keys::PROFILER_ENABLED, false));
+      Project::Entities::EntitiesManager::setParallelUpdate(
+        configReader.getBoolValue(Keys::SCRIPTING_SECTION, Keys::SCRIPTING_PARALLEL_UPDATE, false));
+      Project::Systems::PhysicsSystem::setDefaultBroadPhaseType(Project::Utilities::BroadPhaseTypeResolver::resolve(
+        configReader.getValue(Keys::PHYSICS_SECTION, Keys::PHYSICS_BROAD_PHASE, Project::Libraries::Modes::BroadPhases::AUTO)));
+
       std::string title = configReader.getValue(Keys::WINDOW_SECTION, Keys::WINDOW_TITLE, Constants::PROJECT_NAME);
       int screenWidth = configReader.getIntValue(Keys::WINDOW_SECTION, Keys::WINDOW_WIDTH, Constants::DEFAULT_SCREEN_WIDTH);
       int screenHeight = configReader.getIntValue(Keys::WINDOW_SECTION, Keys::WINDOW_HEIGHT, Constants::DEFAULT_SCREEN_HEIGHT);
@@ -84,6 +110,17 @@ namespace Project::Core {
       bool opengl = configReader.getBoolValue(Keys::VIDEO_SECTION, Keys::VIDEO_OPENGL, true);
       bool vsync = configReader.getBoolValue(Keys::VIDEO_SECTION, Keys::VIDEO_VSYNC, true);
 
+      headless = headless || configReader.getBoolValue(Keys::HEADLESS_SECTION, Keys::HEADLESS_ENABLED, false);
+      headlessUnlocked = headlessUnlocked || configReader.getBoolValue(Keys::HEADLESS_SECTION, Keys::HEADLESS_UNLOCKED, false);
+      if (headlessMaxTicks == 0) {
+        headlessMaxTicks = std::max(0, configReader.getIntValue(Keys::HEADLESS_SECTION, Keys::HEADLESS_MAX_TICKS, 0));
+      }
+      headlessTickRate = configReader.getDoubleValue(Keys::HEADLESS_SECTION, Keys::HEADLESS_TICK_RATE, Constants::TARGET_FPS);
+      if (headlessTickRate <= 0.0) {
+        headlessTickRate = Constants::TARGET_FPS;
+      }
+      platform->setHeadless(headless);
+
       // if (opengl) {
       //   platform->setRendererAPI(std::make_unique<Project::Platform::OpenGLRenderer>());
       // } else {
@@ -95,7 +132,9 @@ namespace Project::Core {
         throw EngineException("SDL initialization failed", Project::Utilities::ErrorCategory::SDL);
       }
 
-      SDL_ShowCursor(SDL_DISABLE);
+      if (!headless) {
+        SDL_ShowCursor(SDL_DISABLE);
+      }
       std::string fontRelPath = configReader.getValue(Keys::FONT_SECTION, Keys::FONT_DEFAULT_PATH, Constants::DEFAULT_FONT_PATH);
       if (!Project::Helpers::checkNotNull(logsManager, resourcesHandler.get(), "ResourcesHandler is null.")) {
         throw EngineException("ResourcesHandler is null", Project::Utilities::ErrorCategory::RESOURCE);
@@ -155,6 +194,11 @@ namespace Project::Core {
   }
 
   void GameEngine::run() {
+    if (headless) {
+      runHeadless();
+      return;
+    }
+
     double accumulator = 0.0;
     const double fixedDelta = Constants::DEFAULT_WHOLE / Constants::TARGET_FPS;
     try {
@@ -189,6 +233,47 @@ namespace Project::Core {
     }
   }
 
+  void GameEngine::runHeadless() {
+    const double tickDelta = Constants::DEFAULT_WHOLE / headlessTickRate;
+    const auto tickDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(tickDelta));
+    auto nextTick = std::chrono::steady_clock::now();
+    long long ticks = 0;
+
+    logsManager.logMessage("Running headless at " + std::to_string(headlessTickRate) + " ticks per second" + (headlessUnlocked ? " (unlocked)." : "."));
+    try {
+      while (isRunning) {
+        Project::Utilities::Profiler::getInstance().beginFrame();
+        framesCounter.update();
+
+        handleEvents();
+        if (!isRunning) {
+          break;
+        }
+
+        update(static_cast<float>(tickDelta));
+        if (headlessMaxTicks > 0 && ++ticks >= headlessMaxTicks) {
+          logsManager.logMessage("Headless tick limit reached: " + std::to_string(ticks));
+          clean();
+          break;
+        }
+
+        if (!headlessUnlocked) {
+          nextTick += tickDuration;
+          const auto now = std::chrono::steady_clock::now();
+          if (nextTick > now) {
+            std::this_thread::sleep_until(nextTick);
+          } else {
+            nextTick = now;
+          }
+        }
+      }
+    } catch (const std::exception& e) {
+      logsManager.logError(std::string("Runtime exception: ") + e.what());
+      logsManager.flushLogs();
+      clean();
+    }
+  }
+
   void GameEngine::handleEvents() {
     SDL_Event event;
     while (SDL_PollEvent(&event) != 0) {
@@ -305,6 +390,16 @@ namespace Project::Core {
     if (sceneCache) {
       sceneCache->logDiagnostics();
     }
+
+    auto& profiler = Project::Utilities::Profiler::getInstance();
+    if (profiler.isEnabled()) {
+      const std::string tracePath = configReader.getValue(Keys::PROFILER_SECTION, Keys::PROFILER_TRACE_PATH, Constants::DEFAULT_TRACE_FILE_PATH);
+      if (profiler.exportChromeTrace(tracePath)) {
+        logsManager.logMessage("Profiler trace written to " + tracePath);
+      } else {
+        logsManager.logError("Failed to write profiler trace: " + tracePath);
+      }
+    }
     logsManager.logMessage("Game engine cleanup complete.");
     logsManager.flushLogs();
   }
@@ -28,6 +28,7 @@ namespace Project::Core {
     GameEngine();
     ~GameEngine();
 
+    void parseArguments(int argc, char* argv[]);
     void init();
     void run();
     void clean();
@@ -54,9 +55,15 @@ namespace Project::Core {
     double entityLoadFactor;
     double frameTimeAvg;
     double maxFPS;
+    double headlessTickRate;
+
+    long long headlessMaxTicks;
 
     bool isRunning;
+    bool headless;
+    bool headlessUnlocked;
 
+    void runHeadless();
     void handleEvents();
     void update(float deltaTime);
     void render();
@@ -0,0 +1,254 @@
+#include "ArchetypeStorage.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "components/bounding_box_component/BoundingBoxComponent.h"
+#include "components/graphics_component/GraphicsComponent.h"
+
+namespace Project::Entities {
+  using Project::Components::BaseComponent;
+  using Project::Components::ComponentType;
+
+  namespace Constants = Project::Libraries::Constants;
+
+  namespace {
+    template <typename T>
+    void writeComponentPayload(const BaseComponent* component, void* payload) {
+      auto* target = new (payload) typename T::Payload();
+      static_cast<const T*>(component)->writePayload(*target);
+    }
+
+    template <typename T>
+    ComponentPayloadLayout payloadLayoutOf() {
+      return ComponentPayloadLayout{sizeof(typename T::Payload), &writeComponentPayload<T>};
+    }
+  }
+
+  ComponentPayloadLayout getComponentPayloadLayout(ComponentType type) {
+    switch (type) {
+      case ComponentType::BOUNDING_BOX: return payloadLayoutOf<Project::Components::BoundingBoxComponent>();
+      case ComponentType::GRAPHICS: return payloadLayoutOf<Project::Components::GraphicsComponent>();
+      default: return ComponentPayloadLayout{};
+    }
+  }
+
+  ArchetypeChunk::ArchetypeChunk(size_t columnCount, size_t payloadBytes)
+  : owners(Constants::ARCHETYPE_CHUNK_CAPACITY, nullptr),
+    components(columnCount * Constants::ARCHETYPE_CHUNK_CAPACITY, nullptr),
+    extras(Constants::ARCHETYPE_CHUNK_CAPACITY),
+    payloads(payloadBytes * Constants::ARCHETYPE_CHUNK_CAPACITY),
+    columnCount(columnCount) {}
+
+  size_t ArchetypeChunk::pushRow(Entity* owner, const std::vector<ComponentType>& types,
+    const std::vector<PayloadColumn>& payloadColumns, const ComponentRow& row) {
+    size_t index = count++;
+    owners[index] = owner;
+    for (size_t column = 0; column < columnCount; ++column) {
+      components[column * Constants::ARCHETYPE_CHUNK_CAPACITY + index] = row.first[static_cast<size_t>(types[column])];
+    }
+    extras[index] = row.extra;
+    for (const PayloadColumn& payload : payloadColumns) {
+      BaseComponent* component = components[payload.column * Constants::ARCHETYPE_CHUNK_CAPACITY + index];
+      component->consumePayloadDirty();
+      payload.layout.write(component, payloadAt(payload, index));
+    }
+    return index;
+  }
+
+  void ArchetypeChunk::moveRow(size_t dstRow, ArchetypeChunk& src, size_t srcRow, const std::vector<PayloadColumn>& payloadColumns) {
+    owners[dstRow] = src.owners[srcRow];
+    for (size_t column = 0; column < columnCount; ++column) {
+      size_t offset = column * Constants::ARCHETYPE_CHUNK_CAPACITY;
+      components[offset + dstRow] = src.components[offset + srcRow];
+    }
+    extras[dstRow] = std::move(src.extras[srcRow]);
+    for (const PayloadColumn& payload : payloadColumns) {
+      std::memcpy(payloadAt(payload, dstRow), src.payloadAt(payload, srcRow), payload.layout.size);
+    }
+  }
+
+  void ArchetypeChunk::popRow() {
+    if (count == 0) return;
+    --count;
+    owners[count] = nullptr;
+    for (size_t column = 0; column < columnCount; ++column) {
+      components[column * Constants::ARCHETYPE_CHUNK_CAPACITY + count] = nullptr;
+    }
+    extras[count].clear();
+  }
+
+  void ArchetypeChunk::refreshPayloads(const std::vector<PayloadColumn>& payloadColumns) {
+    for (const PayloadColumn& payload : payloadColumns) {
+      BaseComponent* const* column = getColumn(payload.column);
+      for (size_t row = 0; row < count; ++row) {
+        if (!column[row]->consumePayloadDirty()) continue;
+        payload.layout.write(column[row], payloadAt(payload, row));
+      }
+    }
+  }
+
+  Archetype::Archetype(const ComponentMask& archetypeMask) : mask(archetypeMask) {
+    columns.fill(-1);
+    for (size_t bit = 0; bit < mask.size(); ++bit) {
+      if (mask.test(bit)) {
+        columns[bit] = static_cast<int>(types.size());
+        types.push_back(static_cast<ComponentType>(bit));
+
+        ComponentPayloadLayout layout = getComponentPayloadLayout(types.back());
+        if (layout.size > 0) {
+          payloadColumns.push_back(PayloadColumn{types.size() - 1, payloadBytes, layout});
+          payloadBytes += layout.size;
+        }
+      }
+    }
+  }
+
+  const PayloadColumn* Archetype::getPayloadColumn(ComponentType type) const {
+    int column = getColumn(type);
+    if (column < 0) return nullptr;
+    for (const PayloadColumn& payload : payloadColumns) {
+      if (payload.column == static_cast<size_t>(column)) return &payload;
+    }
+    return nullptr;
+  }
+
+  void Archetype::add(Entity* entity, const ComponentRow& row, ArchetypeLocation& location) {
+    if (chunks.empty() || chunks.back().isFull()) {
+      chunks.emplace_back(types.size(), payloadBytes);
+    }
+    location.chunk = chunks.size() - 1;
+    location.row = chunks.back().pushRow(entity, types, payloadColumns, row);
+    ++entityCount;
+  }
+
+  Entity* Archetype::remove(const ArchetypeLocation& location) {
+    if (location.chunk >= chunks.size() || location.row >= chunks[location.chunk].size()) return nullptr;
+
+    ArchetypeChunk& last = chunks.back();
+    size_t lastRow = last.size() - 1;
+    Entity* moved = nullptr;
+
+    if (location.chunk != chunks.size() - 1 || location.row != lastRow) {
+      chunks[location.chunk].moveRow(location.row, last, lastRow, payloadColumns);
+      moved = chunks[location.chunk].getOwners()[location.row];
+    }
+
+    last.popRow();
+    if (last.size() == 0) {
+      chunks.pop_back();
+    }
+    --entityCount;
+    return moved;
+  }
+
+  void Archetype::refreshPayloads() {
+    if (payloadColumns.empty()) return;
+    for (ArchetypeChunk& chunk : chunks) {
+      chunk.refreshPayloads(payloadColumns);
+    }
+  }
+
+  void Archetype::clear() {
+    chunks.clear();
+    chunks.shrink_to_fit();
+    entityCount = 0;
+  }
+
+  ArchetypeLocation ArchetypeStorage::add(Entity* entity, const ComponentMask& mask, const ComponentRow& row) {
+    ArchetypeLocation location;
+    unsigned long long key = mask.to_ullong();
+    auto it = archetypeLookup.find(key);
+    if (it == archetypeLookup.end()) {
+      std::unique_lock<std::shared_mutex> lock(queryMutex);
+      if (!freeArchetypes.empty()) {
+        location.archetype = freeArchetypes.back();
+        freeArchetypes.pop_back();
+        archetypes[location.archetype] = Archetype(mask);
+      } else {
+        location.archetype = archetypes.size();
+        archetypes.emplace_back(mask);
+      }
+      archetypeLookup[key] = location.archetype;
+
+      for (auto& query : queries) {
+        if (query->accepts(mask)) query->matches.push_back(location.archetype);
+      }
+    } else {
+      location.archetype = it->second;
+    }
+    archetypes[location.archetype].add(entity, row, location);
+    return location;
+  }
+
+  Entity* ArchetypeStorage::remove(const ArchetypeLocation& location) {
+    if (location.archetype >= archetypes.size()) return nullptr;
+    Archetype& archetype = archetypes[location.archetype];
+    if (archetype.size() == 0) return nullptr;
+
+    Entity* moved = archetype.remove(location);
+    if (archetype.size() == 0) {
+      releaseArchetype(location.archetype);
+    }
+    return moved;
+  }
+
+  void ArchetypeStorage::releaseArchetype(size_t index) {
+    std::unique_lock<std::shared_mutex> lock(queryMutex);
+    Archetype& archetype = archetypes[index];
+    archetypeLookup.erase(archetype.getMask().to_ullong());
+    for (auto& query : queries) {
+      auto& matches = query->matches;
+      matches.erase(std::remove(matches.begin(), matches.end(), index), matches.end());
+    }
+    archetype.clear();
+    freeArchetypes.push_back(index);
+  }
+
+  void ArchetypeStorage::refreshPayloads() {
+    for (Archetype& archetype : archetypes) {
+      archetype.refreshPayloads();
+    }
+  }
+
+  void ArchetypeStorage::clear() {
+    std::unique_lock<std::shared_mutex> lock(queryMutex);
+    archetypes.clear();
+    freeArchetypes.clear();
+    archetypeLookup.clear();
+
+    for (auto& query : queries) {
+      query->matches.clear();
+    }
+  }
+
+  const Archetype* ArchetypeStorage::findArchetype(const ComponentMask& mask) const {
+    auto it = archetypeLookup.find(mask.to_ullong());
+    return it != archetypeLookup.end() ? &archetypes[it->second] : nullptr;
+  }
+
+  const std::vector<size_t>& ArchetypeStorage::getQueryMatches(const ComponentMask& include, const ComponentMask& exclude) const {
+    auto key = std::make_pair(include.to_ullong(), exclude.to_ullong());
+    {
+      std::shared_lock<std::shared_mutex> lock(queryMutex);
+      auto it = queryLookup.find(key);
+      if (it != queryLookup.end()) return it->second->matches;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(queryMutex);
+    auto it = queryLookup.find(key);
+    if (it != queryLookup.end()) return it->second->matches;
+
+    auto query = std::make_unique<CachedQuery>();
+    query->include = include;
+    query->exclude = exclude;
+    for (size_t i = 0; i < archetypes.size(); ++i) {
+      if (archetypes[i].size() > 0 && query->accepts(archetypes[i].getMask())) query->matches.push_back(i);
+    }
+
+    CachedQuery* raw = query.get();
+    queries.push_back(std::move(query));
+    queryLookup[key] = raw;
+    return raw->matches;
+  }
+}
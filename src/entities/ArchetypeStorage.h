@@ -0,0 +1,153 @@
+#ifndef ARCHETYPE_STORAGE_H
+#define ARCHETYPE_STORAGE_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "components/BaseComponent.h"
+#include "components/ComponentType.h"
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Entities {
+  class Entity;
+
+  using ComponentMask = std::bitset<Project::Libraries::Constants::BIT_64>;
+
+  struct ComponentRow {
+    std::array<Project::Components::BaseComponent*, Project::Libraries::Constants::BIT_64> first{};
+    std::vector<Project::Components::BaseComponent*> extra;
+  };
+
+  struct ArchetypeLocation {
+    size_t archetype = 0;
+    size_t chunk = 0;
+    size_t row = 0;
+  };
+
+  struct ComponentPayloadLayout {
+    size_t size = 0;
+    void (*write)(const Project::Components::BaseComponent* component, void* payload) = nullptr;
+  };
+
+  ComponentPayloadLayout getComponentPayloadLayout(Project::Components::ComponentType type);
+
+  struct PayloadColumn {
+    size_t column = 0;
+    size_t offset = 0;
+    ComponentPayloadLayout layout;
+  };
+
+  class ArchetypeChunk {
+  public:
+    ArchetypeChunk(size_t columnCount, size_t payloadBytes);
+
+    size_t size() const { return count; }
+    bool isFull() const { return count == Project::Libraries::Constants::ARCHETYPE_CHUNK_CAPACITY; }
+
+    Entity* const* getOwners() const { return owners.data(); }
+    Project::Components::BaseComponent* const* getColumn(size_t column) const {
+      return components.data() + column * Project::Libraries::Constants::ARCHETYPE_CHUNK_CAPACITY;
+    }
+    const std::vector<Project::Components::BaseComponent*>& getExtras(size_t row) const { return extras[row]; }
+
+    template <typename Payload>
+    const Payload* getPayloads(const PayloadColumn& column) const {
+      return std::launder(reinterpret_cast<const Payload*>(payloads.data() + column.offset * Project::Libraries::Constants::ARCHETYPE_CHUNK_CAPACITY));
+    }
+
+    size_t pushRow(Entity* owner, const std::vector<Project::Components::ComponentType>& types,
+      const std::vector<PayloadColumn>& payloadColumns, const ComponentRow& row);
+    void moveRow(size_t dstRow, ArchetypeChunk& src, size_t srcRow, const std::vector<PayloadColumn>& payloadColumns);
+    void popRow();
+    void refreshPayloads(const std::vector<PayloadColumn>& payloadColumns);
+
+  private:
+    std::vector<Entity*> owners;
+    std::vector<Project::Components::BaseComponent*> components;
+    std::vector<std::vector<Project::Components::BaseComponent*>> extras;
+    std::vector<unsigned char> payloads;
+    size_t columnCount = 0;
+    size_t count = 0;
+
+    unsigned char* payloadAt(const PayloadColumn& column, size_t row) {
+      return payloads.data() + (column.offset * Project::Libraries::Constants::ARCHETYPE_CHUNK_CAPACITY) + row * column.layout.size;
+    }
+  };
+
+  class Archetype {
+  public:
+    explicit Archetype(const ComponentMask& mask);
+
+    const ComponentMask& getMask() const { return mask; }
+    const std::vector<Project::Components::ComponentType>& getTypes() const { return types; }
+    const std::vector<ArchetypeChunk>& getChunks() const { return chunks; }
+
+    int getColumn(Project::Components::ComponentType type) const { return columns[static_cast<size_t>(type)]; }
+    const PayloadColumn* getPayloadColumn(Project::Components::ComponentType type) const;
+    size_t size() const { return entityCount; }
+
+    void add(Entity* entity, const ComponentRow& row, ArchetypeLocation& location);
+    Entity* remove(const ArchetypeLocation& location);
+    void refreshPayloads();
+    void clear();
+
+  private:
+    ComponentMask mask;
+    std::array<int, Project::Libraries::Constants::BIT_64> columns;
+    std::vector<Project::Components::ComponentType> types;
+    std::vector<PayloadColumn> payloadColumns;
+    std::vector<ArchetypeChunk> chunks;
+    size_t payloadBytes = 0;
+    size_t entityCount = 0;
+  };
+
+  class ArchetypeStorage {
+  public:
+    ArchetypeLocation add(Entity* entity, const ComponentMask& mask, const ComponentRow& row);
+    Entity* remove(const ArchetypeLocation& location);
+    void refreshPayloads();
+    void clear();
+
+    const Archetype* findArchetype(const ComponentMask& mask) const;
+    const std::vector<Archetype>& getArchetypes() const { return archetypes; }
+    // Matches are cached per mask pair and patched in place when archetypes come and go, so the
+    // returned list stays valid while entity structure is not changed (commands are deferred during updates).
+    const std::vector<size_t>& getQueryMatches(const ComponentMask& include, const ComponentMask& exclude = ComponentMask()) const;
+
+  private:
+    struct CachedQuery {
+      ComponentMask include;
+      ComponentMask exclude;
+      std::vector<size_t> matches;
+
+      bool accepts(const ComponentMask& mask) const {
+        return (mask & include) == include && (mask & exclude).none();
+      }
+    };
+
+    struct QueryKeyHash {
+      size_t operator()(const std::pair<unsigned long long, unsigned long long>& key) const {
+        return std::hash<unsigned long long>{}(key.first) ^ (std::hash<unsigned long long>{}(key.second) << 1);
+      }
+    };
+
+    std::vector<Archetype> archetypes;
+    std::vector<size_t> freeArchetypes;
+    std::unordered_map<unsigned long long, size_t> archetypeLookup;
+
+    mutable std::vector<std::unique_ptr<CachedQuery>> queries;
+    mutable std::unordered_map<std::pair<unsigned long long, unsigned long long>, CachedQuery*, QueryKeyHash> queryLookup;
+    mutable std::shared_mutex queryMutex;
+
+    void releaseArchetype(size_t index);
+  };
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef COMPONENT_QUERY_H
+#define COMPONENT_QUERY_H
+
+#include "ArchetypeStorage.h"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Project::Entities {
+  template <typename... Components>
+  class ComponentQuery {
+  public:
+    using Row = std::tuple<Entity*, Components*...>;
+
+    class Iterator {
+    public:
+      Iterator(const ArchetypeStorage* storage, const std::vector<size_t>* matches, size_t match)
+      : storage(storage), matches(matches), match(match) {
+        settle();
+      }
+
+      Row operator*() const {
+        return makeRow(std::index_sequence_for<Components...>{});
+      }
+
+      Iterator& operator++() {
+        if (nextInstance()) return *this;
+        ++row;
+        if (row >= chunk->size()) {
+          row = 0;
+          ++chunkIndex;
+          settle();
+        } else {
+          loadRow();
+        }
+        return *this;
+      }
+
+      bool operator==(const Iterator& other) const {
+        return match == other.match && chunkIndex == other.chunkIndex && row == other.row && instances == other.instances;
+      }
+
+      bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+      static constexpr size_t COUNT = sizeof...(Components);
+      static constexpr std::array<Project::Components::ComponentType, COUNT> TYPES{Components::TYPE...};
+
+      const ArchetypeStorage* storage;
+      const std::vector<size_t>* matches;
+      const ArchetypeChunk* chunk = nullptr;
+      std::array<size_t, COUNT> columns{};
+      std::array<size_t, COUNT> instances{};
+      std::array<size_t, COUNT> counts{};
+      size_t match = 0;
+      size_t chunkIndex = 0;
+      size_t row = 0;
+
+      void settle() {
+        while (match < matches->size()) {
+          const Archetype& archetype = storage->getArchetypes()[(*matches)[match]];
+          const auto& chunks = archetype.getChunks();
+          if (chunkIndex < chunks.size()) {
+            chunk = &chunks[chunkIndex];
+            for (size_t i = 0; i < COUNT; ++i) {
+              columns[i] = static_cast<size_t>(archetype.getColumn(TYPES[i]));
+            }
+            loadRow();
+            return;
+          }
+          ++match;
+          chunkIndex = 0;
+        }
+        chunk = nullptr;
+        chunkIndex = 0;
+        row = 0;
+        instances.fill(0);
+      }
+
+      void loadRow() {
+        instances.fill(0);
+        counts.fill(1);
+        for (const auto* extra : chunk->getExtras(row)) {
+          for (size_t i = 0; i < COUNT; ++i) {
+            if (extra->getType() == TYPES[i]) ++counts[i];
+          }
+        }
+      }
+
+      bool nextInstance() {
+        for (size_t i = 0; i < COUNT; ++i) {
+          if (++instances[i] < counts[i]) return true;
+          instances[i] = 0;
+        }
+        return false;
+      }
+
+      Project::Components::BaseComponent* instance(size_t i) const {
+        if (instances[i] == 0) return chunk->getColumn(columns[i])[row];
+        size_t skip = instances[i] - 1;
+        for (auto* extra : chunk->getExtras(row)) {
+          if (extra->getType() != TYPES[i]) continue;
+          if (skip-- == 0) return extra;
+        }
+        return nullptr;
+      }
+
+      template <size_t... I>
+      Row makeRow(std::index_sequence<I...>) const {
+        return Row(chunk->getOwners()[row], static_cast<Components*>(instance(I))...);
+      }
+    };
+
+    explicit ComponentQuery(const ArchetypeStorage& storage, const ComponentMask& exclude = ComponentMask())
+    : storage(&storage), matches(storage.getQueryMatches(includeMask(), exclude)) {}
+
+    static ComponentMask includeMask() {
+      ComponentMask mask;
+      (mask.set(static_cast<size_t>(Components::TYPE)), ...);
+      return mask;
+    }
+
+    Iterator begin() const { return Iterator(storage, &matches, 0); }
+    Iterator end() const { return Iterator(storage, &matches, matches.size()); }
+
+  private:
+    const ArchetypeStorage* storage;
+    const std::vector<size_t>& matches;
+  };
+
+  template <typename Component>
+  class PayloadQuery {
+  public:
+    using Payload = typename Component::Payload;
+    using Row = std::pair<Entity*, const Payload*>;
+
+    class Iterator {
+    public:
+      Iterator(const ArchetypeStorage* storage, const std::vector<size_t>* matches, size_t match)
+      : storage(storage), matches(matches), match(match) {
+        settle();
+      }
+
+      Row operator*() const {
+        if (extra == 0) return Row(chunk->getOwners()[row], payloads + row);
+        return Row(chunk->getOwners()[row], &scratch);
+      }
+
+      Iterator& operator++() {
+        if (nextExtra()) return *this;
+        extra = 0;
+        ++row;
+        if (row >= chunk->size()) {
+          row = 0;
+          ++chunkIndex;
+          settle();
+        }
+        return *this;
+      }
+
+      bool operator==(const Iterator& other) const {
+        return match == other.match && chunkIndex == other.chunkIndex && row == other.row && extra == other.extra;
+      }
+
+      bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+      const ArchetypeStorage* storage;
+      const std::vector<size_t>* matches;
+      const ArchetypeChunk* chunk = nullptr;
+      const PayloadColumn* column = nullptr;
+      const Payload* payloads = nullptr;
+      Payload scratch{};
+      size_t match = 0;
+      size_t chunkIndex = 0;
+      size_t row = 0;
+      size_t extra = 0;
+
+      void settle() {
+        while (match < matches->size()) {
+          const Archetype& archetype = storage->getArchetypes()[(*matches)[match]];
+          const auto& chunks = archetype.getChunks();
+          column = archetype.getPayloadColumn(Component::TYPE);
+          if (column && chunkIndex < chunks.size()) {
+            chunk = &chunks[chunkIndex];
+            payloads = chunk->template getPayloads<Payload>(*column);
+            return;
+          }
+          ++match;
+          chunkIndex = 0;
+        }
+        chunk = nullptr;
+        chunkIndex = 0;
+        row = 0;
+      }
+
+      bool nextExtra() {
+        const auto& extras = chunk->getExtras(row);
+        size_t seen = 0;
+        for (const auto* component : extras) {
+          if (component->getType() != Component::TYPE) continue;
+          if (++seen > extra) {
+            ++extra;
+            column->layout.write(component, &scratch);
+            return true;
+          }
+        }
+        return false;
+      }
+    };
+
+    explicit PayloadQuery(const ArchetypeStorage& storage, const ComponentMask& exclude = ComponentMask())
+    : storage(&storage), matches(storage.getQueryMatches(ComponentQuery<Component>::includeMask(), exclude)) {}
+
+    Iterator begin() const { return Iterator(storage, &matches, 0); }
+    Iterator end() const { return Iterator(storage, &matches, matches.size()); }
+
+  private:
+    const ArchetypeStorage* storage;
+    const std::vector<size_t>& matches;
+  };
+}
+
+#endif
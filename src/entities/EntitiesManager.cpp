@@ -2,13 +2,17 @@
 #include "EntityAttribute.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
-#include <bitset>
 #include <exception>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include <SDL.h>
 
@@ -38,14 +42,39 @@ namespace Project::Entities {
   namespace Keys = Project::Libraries::Keys;
   namespace LuaBindings = Project::Bindings::LuaBindings;
 
+  namespace {
+    std::atomic<uint64_t> nextCommandBufferKey{1};
+
+    void collectComponentRow(Entity* entity, ComponentMask& mask, ComponentRow& row) {
+      for (const std::string& compName : entity->listComponentNames()) {
+        auto* comp = entity->getComponent(compName);
+        if (!comp) continue;
+        size_t bit = static_cast<size_t>(comp->getType());
+        if (!row.first[bit]) {
+          row.first[bit] = comp;
+        } else {
+          row.extra.push_back(comp);
+        }
+        mask.set(bit);
+      }
+    }
+  }
+
+  bool EntitiesManager::parallelUpdateEnabled = false;
+
+  std::unique_lock<std::mutex> EntitiesManager::lockSharedState() {
+    static std::mutex sharedStateMutex;
+    return std::unique_lock<std::mutex>(sharedStateMutex);
+  }
+
   EntitiesManager::EntitiesManager()
     : persistentFunctionCache(Constants::SCRIPT_FUNCTION_CACHE_FILE) {
     entityList.reserve(Constants::MAX_MEMORY_SPACE);
-    updateHigh.reserve(Constants::MAX_MEMORY_SPACE);
-    updateNormal.reserve(Constants::MAX_MEMORY_SPACE);
-    updateLow.reserve(Constants::MAX_MEMORY_SPACE);
-    updateToRemove.reserve(Constants::MAX_MEMORY_SPACE);
+    for (auto& bucket : priorityBuckets) bucket.reserve(Constants::MAX_MEMORY_SPACE);
+    pendingCommands.reserve(Constants::MAX_MEMORY_SPACE);
+    commandBufferKey = nextCommandBufferKey.fetch_add(1, std::memory_order_relaxed);
 
+    motionSystem.setStorage(&archetypeStorage);
     scheduler.addSystem(Components::BEHAVIOR, &behaviorSystem);
     scheduler.addSystem(Components::MOTION, &motionSystem);
     scheduler.addSystem(Components::PHYSICS, &physicsSystem, {Components::MOTION});
@@ -57,6 +86,12 @@ namespace Project::Entities {
   }
 
   std::string EntitiesManager::addEntity(std::shared_ptr<Entity> entity, const std::string& id) {
+    std::string finalId = insertEntity(std::move(entity), id);
+    if (!finalId.empty()) clampToMapRect(getEntity(finalId));
+    return finalId;
+  }
+
+  std::string EntitiesManager::insertEntity(std::shared_ptr<Entity> entity, const std::string& id) {
     if (!entity) return Constants::EMPTY_STRING;
 
     std::lock_guard<std::mutex> lock(managerMutex);
@@ -80,165 +115,340 @@ namespace Project::Entities {
     }
     
     entity->setEntityID(finalId);
-    
+
+    uint32_t slotIndex;
+    if (!freeEntitySlots.empty()) {
+      slotIndex = freeEntitySlots.back();
+      freeEntitySlots.pop_back();
+    } else {
+      slotIndex = static_cast<uint32_t>(entitySlots.size());
+      entitySlots.emplace_back();
+    }
+
+    EntitySlot& slot = entitySlots[slotIndex];
+    entity->setHandle(EntityHandle(slotIndex, slot.generation));
+    slot.entity = entity;
+    slot.listIndex = entityList.size();
+    slot.seenInCamera = false;
+
     objects[finalId] = std::move(entity);
     objects[finalId]->getLuaStateWrapper().setGlobalString(Keys::ID, finalId);
     entityList.push_back(objects[finalId]);
-    entityIndices[finalId] = entityList.size() - 1;
     
     auto& entRef = objects[finalId];
     if (entRef) {
-      bool hasPhys = false;
-      Project::Components::BoundingBoxComponent* box = nullptr;
-      std::bitset<Constants::BIT_64> mask;
-      for (const std::string& compName : entRef->listComponentNames()) {
-        auto* comp = entRef->getComponent(compName);
-        if (!comp) continue;
+      ComponentMask mask;
+      ComponentRow row{};
+      collectComponentRow(entRef.get(), mask, row);
+      registerComponents(entRef.get());
+      slot.location = archetypeStorage.add(entRef.get(), mask, row);
+      slot.serialUpdate = requiresSerialUpdate(entRef.get());
+      addToPriorityBucket(slot, entRef.get());
+    }
 
-        auto type = comp->getType();
-        auto& storage = componentArrays[type];
-        storage.reserve(Constants::MAX_MEMORY_SPACE);
-        storage.add(comp);
-        mask.set(static_cast<size_t>(type));
-
-        switch (type) {
-          case Project::Components::ComponentType::BEHAVIOR:
-            behaviorSystem.add(static_cast<Project::Components::BehaviorComponent*>(comp));
-            break;
-          case Project::Components::ComponentType::MOTION:
-            motionSystem.add(static_cast<Project::Components::MotionComponent*>(comp));
-            break;
-          case Project::Components::ComponentType::PHYSICS:
-            physicsSystem.add(static_cast<Project::Components::PhysicsComponent*>(comp));
-            hasPhys = true;
-            break;
-          case Project::Components::ComponentType::GRAPHICS:
-            renderSystem.add(static_cast<Project::Components::GraphicsComponent*>(comp));
-            break;
-          case Project::Components::ComponentType::BOUNDING_BOX:
-            box = static_cast<Project::Components::BoundingBoxComponent*>(comp);
-            break;
-          default:
-            break;
-        }
-      }
+    std::string group = objects[finalId]->getGroup();
+    if (!group.empty()) {
+      auto& handles = entityGroups[group];
+      EntityHandle handle = objects[finalId]->getHandle();
+      entitySlots[handle.index].groupIndex = handles.size();
+      handles.push_back(handle);
+    }
 
-      if (box && !hasPhys) {
-        physicsSystem.addStaticCollider(box);
-      }
+    return finalId;
+  }
 
-      size_t key = mask.to_ullong();
-      size_t archIndex;
-      auto lookup = archetypeLookup.find(key);
-      if (lookup == archetypeLookup.end()) {
-        archIndex = archetypes.size();
-        archetypes.emplace_back();
-        archetypeKeys.push_back(key);
-        archetypeLookup[key] = archIndex;
-      } else {
-        archIndex = lookup->second;
+  void EntitiesManager::registerComponents(Entity* entity) {
+    bool hasPhys = false;
+    Project::Components::BoundingBoxComponent* box = nullptr;
+    for (const std::string& compName : entity->listComponentNames()) {
+      auto* comp = entity->getComponent(compName);
+      if (!comp) continue;
+      switch (comp->getType()) {
+        case Project::Components::ComponentType::BEHAVIOR:
+          behaviorSystem.add(static_cast<Project::Components::BehaviorComponent*>(comp));
+          break;
+        case Project::Components::ComponentType::PHYSICS:
+          physicsSystem.add(static_cast<Project::Components::PhysicsComponent*>(comp));
+          hasPhys = true;
+          break;
+        case Project::Components::ComponentType::GRAPHICS:
+          renderSystem.add(static_cast<Project::Components::GraphicsComponent*>(comp));
+          break;
+        case Project::Components::ComponentType::BOUNDING_BOX:
+          box = static_cast<Project::Components::BoundingBoxComponent*>(comp);
+          break;
+        default:
+          break;
       }
-      archetypes[archIndex].add(entRef.get());
-      entityArchetypes[finalId] = archIndex;
     }
 
-    std::string group = objects[finalId]->getGroup();
-    if (!group.empty()) {
-      entityGroups[group].push_back(finalId);
+    if (box && !hasPhys) {
+      physicsSystem.addStaticCollider(box);
     }
+  }
 
-    if (gameState) {
-      const SDL_Rect& rect = gameState->getMapRect();
-      if (rect.w > 0 && rect.h > 0) {
-        clampEntitiesToRect(rect);
+  void EntitiesManager::unregisterComponents(Entity* entity) {
+    bool hasPhys = false;
+    Project::Components::BoundingBoxComponent* box = nullptr;
+    for (const std::string& compName : entity->listComponentNames()) {
+      auto* comp = entity->getComponent(compName);
+      if (!comp) continue;
+      switch (comp->getType()) {
+        case Project::Components::ComponentType::BEHAVIOR:
+          behaviorSystem.remove(static_cast<Project::Components::BehaviorComponent*>(comp));
+          break;
+        case Project::Components::ComponentType::PHYSICS:
+          physicsSystem.remove(static_cast<Project::Components::PhysicsComponent*>(comp));
+          hasPhys = true;
+          break;
+        case Project::Components::ComponentType::GRAPHICS:
+          renderSystem.remove(static_cast<Project::Components::GraphicsComponent*>(comp));
+          break;
+        case Project::Components::ComponentType::BOUNDING_BOX:
+          box = static_cast<Project::Components::BoundingBoxComponent*>(comp);
+          break;
+        default:
+          break;
       }
     }
 
-    return finalId;
+    if (box && !hasPhys) {
+      physicsSystem.removeStaticCollider(box);
+    }
+  }
+
+  void EntitiesManager::clampToMapRect(const std::shared_ptr<Entity>& entity) {
+    if (!gameState || !entity) return;
+    const SDL_Rect& rect = gameState->getMapRect();
+    if (rect.w > 0 && rect.h > 0) {
+      clampEntityToRect(entity, rect);
+    }
   }
 
   void EntitiesManager::removeEntity(const std::string& id) {
-    auto idxIt = entityIndices.find(id);
-    Entity* entRaw = nullptr;
-
-    if (idxIt != entityIndices.end() && idxIt->second < entityList.size()) {
-      size_t index = idxIt->second;
-      auto ent = entityList[index];
-      entRaw = ent.get();
-      if (ent) {
-        bool hasPhys = false;
-        Project::Components::BoundingBoxComponent* box = nullptr;
-        for (const std::string& compName : ent->listComponentNames()) {
-          auto* comp = ent->getComponent(compName);
-          if (!comp) continue;
-          auto type = comp->getType();
-          componentArrays[type].remove(comp);
-          switch (type) {
-            case Project::Components::ComponentType::BEHAVIOR:
-              behaviorSystem.remove(static_cast<Project::Components::BehaviorComponent*>(comp));
-              break;
-            case Project::Components::ComponentType::MOTION:
-              motionSystem.remove(static_cast<Project::Components::MotionComponent*>(comp));
-              break;
-            case Project::Components::ComponentType::PHYSICS:
-              physicsSystem.remove(static_cast<Project::Components::PhysicsComponent*>(comp));
-              hasPhys = true;
-              break;
-            case Project::Components::ComponentType::GRAPHICS:
-              renderSystem.remove(static_cast<Project::Components::GraphicsComponent*>(comp));
-              break;
-            case Project::Components::ComponentType::BOUNDING_BOX:
-              box = static_cast<Project::Components::BoundingBoxComponent*>(comp);
-              break;
-            default:
-              break;
-          }
-        }
+    auto it = objects.find(id);
+    if (it != objects.end() && it->second) {
+      removeEntity(it->second->getHandle());
+    }
+  }
 
-        if (box && !hasPhys) {
-          physicsSystem.removeStaticCollider(box);
-        }
-      }
+  void EntitiesManager::removeEntity(EntityHandle handle) {
+    if (!hasEntity(handle)) return;
+
+    EntitySlot& slot = entitySlots[handle.index];
+    std::shared_ptr<Entity> ent = std::move(slot.entity);
+    size_t index = slot.listIndex;
+
+    unregisterComponents(ent.get());
 
+    removeFromPriorityBucket(slot, ent.get());
+
+    if (index < entityList.size()) {
       size_t lastIndex = entityList.size() - 1;
       if (index != lastIndex) {
         entityList[index] = entityList[lastIndex];
         if (entityList[index]) {
-          entityIndices[entityList[index]->getEntityID()] = index;
+          entitySlots[entityList[index]->getHandle().index].listIndex = index;
         }
       }
       entityList.pop_back();
-      entityIndices.erase(idxIt);
     }
 
-    for (auto& [group, ids] : entityGroups) {
-      ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
-    }
-    disposableSeenInCamera.erase(id);
-    ObjectsManager<Entity>::remove(id);
-
-    auto archIt = entityArchetypes.find(id);
-    if (archIt != entityArchetypes.end()) {
-      size_t idx = archIt->second;
-      archetypes[idx].remove(entRaw);
-      if (archetypes[idx].entities.empty()) {
-        size_t last = archetypes.size() - 1;
-        size_t key = archetypeKeys[idx];
-        if (idx != last) {
-          archetypes[idx] = std::move(archetypes[last]);
-          size_t movedKey = archetypeKeys[last];
-          archetypeKeys[idx] = movedKey;
-          archetypeLookup[movedKey] = idx;
-          for (auto* e : archetypes[idx].entities) {
-            if (e) entityArchetypes[e->getEntityID()] = idx;
-          }
-        }
-        archetypes.pop_back();
-        archetypeLookup.erase(key);
-        archetypeKeys.pop_back();
+    auto groupIt = entityGroups.find(ent->getGroup());
+    if (groupIt != entityGroups.end()) {
+      auto& handles = groupIt->second;
+      size_t groupIndex = slot.groupIndex;
+      if (groupIndex < handles.size() && handles[groupIndex] == handle) {
+        handles[groupIndex] = handles.back();
+        entitySlots[handles[groupIndex].index].groupIndex = groupIndex;
+        handles.pop_back();
+      } else {
+        handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
       }
-      entityArchetypes.erase(archIt);
     }
+
+    if (Entity* moved = archetypeStorage.remove(slot.location)) {
+      EntitySlot& movedSlot = entitySlots[moved->getHandle().index];
+      movedSlot.location.chunk = slot.location.chunk;
+      movedSlot.location.row = slot.location.row;
+    }
+
+    ++slot.generation;
+    slot.seenInCamera = false;
+    freeEntitySlots.push_back(handle.index);
+
+    ObjectsManager<Entity>::remove(ent->getEntityID());
+  }
+
+  void EntitiesManager::queueAddEntity(std::shared_ptr<Entity> entity, const std::string& id) {
+    if (!entity) return;
+    if (!isDeferringCommands()) {
+      addEntity(std::move(entity), id);
+      return;
+    }
+    getCommandBuffer().create(std::move(entity), id);
+  }
+
+  void EntitiesManager::queueRemoveEntity(const std::string& id) {
+    if (!isDeferringCommands()) {
+      removeEntity(id);
+      return;
+    }
+    getCommandBuffer().destroy(id);
+  }
+
+  void EntitiesManager::queueRemoveEntity(EntityHandle handle) {
+    if (!isDeferringCommands()) {
+      removeEntity(handle);
+      return;
+    }
+    getCommandBuffer().destroy(handle);
+  }
+
+  void EntitiesManager::queueAddComponent(EntityHandle handle, const std::string& componentName, Entity::ComponentPtr component) {
+    if (!component) return;
+    if (!isDeferringCommands()) {
+      EntityCommand command;
+      command.type = EntityCommandType::ADD_COMPONENT;
+      command.handle = handle;
+      command.name = componentName;
+      command.component = std::move(component);
+      applyComponentCommand(command);
+      rebuildRestructuredArchetypes();
+      return;
+    }
+    getCommandBuffer().addComponent(handle, componentName, std::move(component));
+  }
+
+  void EntitiesManager::queueRemoveComponent(EntityHandle handle, const std::string& componentName) {
+    if (!isDeferringCommands()) {
+      EntityCommand command;
+      command.type = EntityCommandType::REMOVE_COMPONENT;
+      command.handle = handle;
+      command.name = componentName;
+      applyComponentCommand(command);
+      rebuildRestructuredArchetypes();
+      return;
+    }
+    getCommandBuffer().removeComponent(handle, componentName);
+  }
+
+  void EntitiesManager::queueCommand(std::function<void()> command) {
+    if (!command) return;
+    if (!isDeferringCommands()) {
+      command();
+      return;
+    }
+    getCommandBuffer().call(std::move(command));
+  }
+
+  EntityCommandBuffer& EntitiesManager::getCommandBuffer() {
+    thread_local std::unordered_map<uint64_t, EntityCommandBuffer*> threadBuffers;
+    auto it = threadBuffers.find(commandBufferKey);
+    if (it != threadBuffers.end()) return *it->second;
+
+    std::lock_guard<std::mutex> lock(commandBufferMutex);
+    commandBuffers.push_back(std::make_unique<EntityCommandBuffer>());
+    EntityCommandBuffer* buffer = commandBuffers.back().get();
+    threadBuffers[commandBufferKey] = buffer;
+    return *buffer;
+  }
+
+  void EntitiesManager::applyComponentCommand(EntityCommand& command) {
+    if (!hasEntity(command.handle)) return;
+    EntitySlot& slot = entitySlots[command.handle.index];
+    Entity* ent = slot.entity.get();
+
+    if (std::find(restructuredEntities.begin(), restructuredEntities.end(), command.handle) == restructuredEntities.end()) {
+      if (Entity* moved = archetypeStorage.remove(slot.location)) {
+        EntitySlot& movedSlot = entitySlots[moved->getHandle().index];
+        movedSlot.location.chunk = slot.location.chunk;
+        movedSlot.location.row = slot.location.row;
+      }
+      unregisterComponents(ent);
+      restructuredEntities.push_back(command.handle);
+    }
+
+    if (ent->getComponent(command.name)) {
+      if (command.type == EntityCommandType::REMOVE_COMPONENT || command.component) {
+        ent->removeComponent(command.name);
+      }
+    }
+
+    if (command.type == EntityCommandType::ADD_COMPONENT && command.component) {
+      ent->addComponent(command.name, std::move(command.component));
+    }
+  }
+
+  void EntitiesManager::flushCommands() {
+    {
+      std::lock_guard<std::mutex> lock(commandBufferMutex);
+      for (auto& buffer : commandBuffers) {
+        buffer->drainInto(pendingCommands);
+      }
+    }
+
+    for (EntityCommand& command : pendingCommands) {
+      if (command.type == EntityCommandType::DEFERRED_CALL && command.callback) {
+        command.callback();
+      }
+    }
+
+    size_t createCount = 0;
+    for (EntityCommand& command : pendingCommands) {
+      if (command.type == EntityCommandType::ADD_COMPONENT || command.type == EntityCommandType::REMOVE_COMPONENT) {
+        applyComponentCommand(command);
+      } else if (command.type == EntityCommandType::CREATE) {
+        ++createCount;
+      }
+    }
+
+    rebuildRestructuredArchetypes();
+
+    for (EntityCommand& command : pendingCommands) {
+      if (command.type != EntityCommandType::DESTROY) continue;
+      if (command.handle.isValid()) {
+        removeEntity(command.handle);
+      } else {
+        removeEntity(command.name);
+      }
+    }
+
+    if (createCount > 0) {
+      if (entityList.capacity() < entityList.size() + createCount) {
+        entityList.reserve(entityList.size() + createCount);
+      }
+      for (EntityCommand& command : pendingCommands) {
+        if (command.type != EntityCommandType::CREATE) continue;
+        std::string finalId = insertEntity(std::move(command.entity), command.name);
+        if (!finalId.empty()) clampToMapRect(getEntity(finalId));
+      }
+    }
+
+    pendingCommands.clear();
+  }
+
+  void EntitiesManager::rebuildRestructuredArchetypes() {
+    for (const EntityHandle& handle : restructuredEntities) {
+      if (!hasEntity(handle)) continue;
+      EntitySlot& slot = entitySlots[handle.index];
+      ComponentMask mask;
+      ComponentRow row{};
+      collectComponentRow(slot.entity.get(), mask, row);
+      registerComponents(slot.entity.get());
+      slot.location = archetypeStorage.add(slot.entity.get(), mask, row);
+      slot.serialUpdate = requiresSerialUpdate(slot.entity.get());
+    }
+    restructuredEntities.clear();
+  }
+
+  void EntitiesManager::discardCommands() {
+    std::lock_guard<std::mutex> lock(commandBufferMutex);
+    for (auto& buffer : commandBuffers) {
+      buffer->clear();
+    }
+    pendingCommands.clear();
+    restructuredEntities.clear();
   }
 
   bool EntitiesManager::hasEntity(const std::string& id) {
@@ -254,6 +464,26 @@ namespace Project::Entities {
     return nullptr;
   }
 
+  bool EntitiesManager::hasEntity(EntityHandle handle) const {
+    if (handle.index >= entitySlots.size()) return false;
+    const EntitySlot& slot = entitySlots[handle.index];
+    return slot.generation == handle.generation && slot.entity != nullptr;
+  }
+
+  std::shared_ptr<Entity> EntitiesManager::getEntity(EntityHandle handle) const {
+    return hasEntity(handle) ? entitySlots[handle.index].entity : nullptr;
+  }
+
+  Entity* EntitiesManager::resolveEntity(EntityHandle handle) const {
+    return hasEntity(handle) ? entitySlots[handle.index].entity.get() : nullptr;
+  }
+
+  EntityHandle EntitiesManager::getEntityHandle(const std::string& id) const {
+    auto it = objects.find(id);
+    if (it != objects.end() && it->second) return it->second->getHandle();
+    return EntityHandle();
+  }
+
   void EntitiesManager::unloadSceneEntities() {
     std::lock_guard<std::mutex> lock(managerMutex);
 
@@ -263,19 +493,13 @@ namespace Project::Entities {
     }
     objects.clear();
     entityList.clear();
-    updateHighCount = updateNormalCount = updateLowCount = updateToRemoveCount = 0;
-
-    entityIndices.clear();
+    discardCommands();
+    releaseEntitySlots();
     entityGroups.clear();
     motionSystem.clear();
     physicsSystem.clear();
     renderSystem.clear();
-    disposableSeenInCamera.clear();
-    componentArrays.clear();
-    archetypes.clear();
-    archetypeLookup.clear();
-    archetypeKeys.clear();
-    entityArchetypes.clear();
+    archetypeStorage.clear();
   }
 
   void EntitiesManager::optimizeEntities() {
@@ -284,17 +508,7 @@ namespace Project::Entities {
   }
 
   void EntitiesManager::initialize() {
-    if (!initialized) {    
-    updateHigh.clear();
-    updateNormal.clear();
-    updateLow.clear();
-
-    if (updateHigh.capacity() < entityList.size())
-      updateHigh.reserve(entityList.size());
-    if (updateNormal.capacity() < entityList.size())
-      updateNormal.reserve(entityList.size());
-    if (updateLow.capacity() < entityList.size())
-      updateLow.reserve(entityList.size());
+    if (!initialized) {
       initialized = true;
       for (const auto& [id, entity] : objects) {
        if (entity && !entity->hasAttribute(EntityAttribute::DEFERRED_INIT)) {
@@ -307,50 +521,19 @@ namespace Project::Entities {
   void EntitiesManager::update(float deltaTime) {
     Project::Utilities::CacheProfiler cacheProfiler;
     cacheProfiler.start();
-    std::vector<std::string> pendingRemove;
+    deferringCommands.store(true, std::memory_order_release);
+    movedEntities.clear();
+    // Portals and vision read payloads from the buckets below, so stale rows are rewritten first.
+    archetypeStorage.refreshPayloads();
     {
-      updateHighCount = 0;
-      updateNormalCount = 0;
-      updateLowCount = 0;
-
-      for (auto& entity : entityList) {
-        if (!entity) continue;
-        if (entity->hasAttribute(EntityAttribute::HIGH_PRIORITY)) {
-          if (updateHighCount < updateHigh.size())
-            updateHigh[updateHighCount] = entity;
-          else
-            updateHigh.push_back(entity);
-          ++updateHighCount;
-        } else if (entity->hasAttribute(EntityAttribute::LOW_PRIORITY)) {
-          if (updateLowCount < updateLow.size())
-            updateLow[updateLowCount] = entity;
-          else
-            updateLow.push_back(entity);
-          ++updateLowCount;
-        } else {
-          if (updateNormalCount < updateNormal.size())
-            updateNormal[updateNormalCount] = entity;
-          else
-            updateNormal.push_back(entity);
-          ++updateNormalCount;
-        }
+      for (const auto& bucket : priorityBuckets) {
+        updateBucket(bucket, deltaTime);
       }
 
-      auto updateEntity = [&](std::shared_ptr<Entity>& ent) {
-        if (!ent) return;
-        if (ent->isActive() || ent->hasAttribute(EntityAttribute::PERMANENT)) {
-          ent->update(deltaTime);
-        }
-      };
-
-      for (size_t i = 0; i < updateHighCount; ++i) updateEntity(updateHigh[i]);
-      for (size_t i = 0; i < updateNormalCount; ++i) updateEntity(updateNormal[i]);
-      for (size_t i = 0; i < updateLowCount; ++i) updateEntity(updateLow[i]);
-
-      updateToRemoveCount = 0;
-
+      EntityCommandBuffer& commands = getCommandBuffer();
       for (const auto& ent : entityList) {
         if (!ent) continue;
+        if (ent->consumeBoundsDirty()) movedEntities.push_back(ent->getHandle());
 
         bool remove = false;
         bool inCamera = isEntityInCamera(ent);
@@ -360,57 +543,246 @@ namespace Project::Entities {
         }
 
         if (ent->hasAttribute(EntityAttribute::DISPOSABLE)) {
-          const auto& id = ent->getEntityID();
+          EntitySlot& slot = entitySlots[ent->getHandle().index];
           if (inCamera) {
-            disposableSeenInCamera.insert(id);
+            slot.seenInCamera = true;
           }
-          if (isEntityOutOfBounds(ent) || (!inCamera && disposableSeenInCamera.count(id))) {
+          if (isEntityOutOfBounds(ent) || (!inCamera && slot.seenInCamera)) {
             remove = true;
           }
         }
 
         if (remove) {
-          if (updateToRemoveCount < updateToRemove.size())
-            updateToRemove[updateToRemoveCount] = ent->getEntityID();
-          else
-            updateToRemove.push_back(ent->getEntityID());
-          ++updateToRemoveCount;
+          commands.destroy(ent->getHandle());
         }
       }
-      pendingRemove.assign(updateToRemove.begin(), updateToRemove.begin() + updateToRemoveCount);
     }
 
-    for (size_t i = 0; i < updateToRemoveCount; ++i) {
-      const auto& id = updateToRemove[i];
-      removeEntity(id);
-      remove(id);
+    scheduler.update(deltaTime);
+    dispatchContactEvents();
+
+    deferringCommands.store(false, std::memory_order_release);
+    flushCommands();
+  }
+
+  void EntitiesManager::updateBucket(const std::vector<Entity*>& bucket, float deltaTime) {
+    size_t count = bucket.size();
+    bool parallel = parallelUpdateEnabled
+      && Project::Utilities::ThreadPool::getInstance().getWorkerCount() > 0
+      && static_cast<float>(count) * entityUpdateCostNs >= Constants::PARALLEL_UPDATE_TARGET_CHUNK_NS;
+    if (parallel) {
+      updateBucketParallel(bucket, deltaTime);
+      return;
     }
 
-    scheduler.update(deltaTime);
+    for (Entity* ent : bucket) {
+      if (ent->isActive() || ent->hasAttribute(EntityAttribute::PERMANENT)) {
+        ent->update(deltaTime);
+      }
+    }
+  }
+
+  void EntitiesManager::updateBucketParallel(const std::vector<Entity*>& bucket, float deltaTime) {
+    parallelEntities.clear();
+    serialEntities.clear();
+    scriptLaneLookup.clear();
+    for (auto& lane : scriptLanes) lane.clear();
+
+    size_t laneCount = 0;
+    for (Entity* ent : bucket) {
+      if (!ent->isActive() && !ent->hasAttribute(EntityAttribute::PERMANENT)) continue;
+
+      if (entitySlots[ent->getHandle().index].serialUpdate) {
+        serialEntities.push_back(ent);
+      } else if (ent->getLuaStateWrapper().isShared()) {
+        auto [it, inserted] = scriptLaneLookup.emplace(ent->getLuaState(), laneCount);
+        if (inserted) {
+          if (scriptLanes.size() <= laneCount) scriptLanes.emplace_back();
+          ++laneCount;
+        }
+        scriptLanes[it->second].push_back(ent);
+      } else {
+        parallelEntities.push_back(ent);
+      }
+    }
+
+    float idealChunk = Constants::PARALLEL_UPDATE_TARGET_CHUNK_NS / std::max(entityUpdateCostNs, Constants::DEFAULT_WHOLE);
+    size_t chunkSize = std::clamp(static_cast<size_t>(idealChunk), Constants::PARALLEL_UPDATE_MIN_CHUNK, Constants::PARALLEL_UPDATE_MAX_CHUNK);
+
+    auto updateRange = [this, deltaTime](Entity* const* entities, size_t rangeCount) {
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < rangeCount; ++i) entities[i]->update(deltaTime);
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      measuredUpdateNs.fetch_add(static_cast<uint64_t>(elapsed), std::memory_order_relaxed);
+      measuredUpdateCount.fetch_add(rangeCount, std::memory_order_relaxed);
+    };
+
+    updateGraph.clear();
+    for (size_t start = 0; start < parallelEntities.size(); start += chunkSize) {
+      Entity* const* entities = parallelEntities.data() + start;
+      size_t rangeCount = std::min(chunkSize, parallelEntities.size() - start);
+      updateGraph.add([updateRange, entities, rangeCount]() { updateRange(entities, rangeCount); });
+    }
+    for (size_t lane = 0; lane < laneCount; ++lane) {
+      Entity* const* entities = scriptLanes[lane].data();
+      size_t rangeCount = scriptLanes[lane].size();
+      updateGraph.add([updateRange, entities, rangeCount]() { updateRange(entities, rangeCount); });
+    }
+
+    measuredUpdateNs.store(0, std::memory_order_relaxed);
+    measuredUpdateCount.store(0, std::memory_order_relaxed);
+    parallelUpdating.store(true, std::memory_order_release);
+    updateGraph.dispatch();
+    updateGraph.wait();
+    parallelUpdating.store(false, std::memory_order_release);
+
+    size_t measured = measuredUpdateCount.load(std::memory_order_relaxed);
+    if (measured > 0) {
+      float sample = static_cast<float>(measuredUpdateNs.load(std::memory_order_relaxed)) / static_cast<float>(measured);
+      entityUpdateCostNs += (sample - entityUpdateCostNs) * Constants::PARALLEL_UPDATE_COST_SMOOTHING;
+    }
+
+    for (Entity* ent : serialEntities) {
+      ent->update(deltaTime);
+    }
+  }
+
+  void EntitiesManager::dispatchContactEvents() {
+    const auto& events = physicsSystem.getContactEvents();
+    if (events.empty()) return;
+
+    contactDeliveries.clear();
+    for (const auto& event : events) {
+      contactDeliveries.push_back({event.first, event.second, event.type});
+      contactDeliveries.push_back({event.second, event.first, event.type});
+    }
+
+    std::sort(contactDeliveries.begin(), contactDeliveries.end(),
+      [](const ContactDelivery& a, const ContactDelivery& b) {
+        if (a.target != b.target) return a.target.toKey() < b.target.toKey();
+        return a.type < b.type;
+      });
+
+    for (size_t i = 0; i < contactDeliveries.size();) {
+      const EntityHandle target = contactDeliveries[i].target;
+      const Project::Systems::ContactEventType type = contactDeliveries[i].type;
+      size_t end = i;
+      while (end < contactDeliveries.size() &&
+             contactDeliveries[end].target == target &&
+             contactDeliveries[end].type == type) {
+        ++end;
+      }
+
+      const char* callback = Keys::LUA_ON_COLLISION_ENTER;
+      if (type == Project::Systems::ContactEventType::STAY) callback = Keys::LUA_ON_COLLISION_STAY;
+      if (type == Project::Systems::ContactEventType::EXIT) callback = Keys::LUA_ON_COLLISION_EXIT;
+
+      Entity* entity = resolveEntity(target);
+      if (entity && entity->getLuaStateWrapper().isGlobalFunction(callback)) {
+        contactTargets.clear();
+        for (size_t j = i; j < end; ++j) {
+          if (Entity* other = resolveEntity(contactDeliveries[j].other)) {
+            contactTargets.push_back(other->getEntityID());
+          }
+        }
+        if (!contactTargets.empty()) {
+          entity->getLuaStateWrapper().callFunctionIfExists(callback, contactTargets);
+        }
+      }
+      i = end;
+    }
+  }
+
+  bool EntitiesManager::requiresSerialUpdate(Entity* entity) const {
+    if (!entity) return true;
+
+    for (const std::string& compName : entity->listComponentNames()) {
+      auto* comp = entity->getComponent(compName);
+      if (!comp) continue;
+      switch (comp->getType()) {
+        case Project::Components::ComponentType::BEHAVIOR:
+        case Project::Components::ComponentType::BOUNDING_BOX:
+        case Project::Components::ComponentType::GRAPHICS:
+        case Project::Components::ComponentType::KEYS:
+        case Project::Components::ComponentType::MOTION:
+        case Project::Components::ComponentType::NUMERIC:
+        case Project::Components::ComponentType::PHYSICS:
+        case Project::Components::ComponentType::TIMER:
+          break;
+        default:
+          return true;
+      }
+    }
+
+    auto cacheIt = scriptFunctionCache.find(entity->getScriptPath());
+    if (cacheIt == scriptFunctionCache.end()) return false;
+    for (const std::string& func : cacheIt->second) {
+      if (func == Keys::LUA_SPAWN_ENTITY || func == Keys::LUA_GET_VISIBLE_ENTITIES ||
+          func == Keys::LUA_GET_NETWORK_PAYLOAD || func == Keys::LUA_SET_NETWORK_CONNECTION ||
+          func == Keys::LUA_ADD_COMPONENT) {
+        return true;
+      }
+
+      if (func == Keys::LUA_GET_COLLIDED_ENTITY || func == Keys::LUA_GET_ENTITY_DETAILS ||
+          func == Keys::LUA_GET_ENTITY_SPEED || func == Keys::LUA_GET_ENTITY_VELOCITY ||
+          func == Keys::LUA_GET_ENTITY_ROTATION || func == Keys::LUA_GET_NUMERIC_VALUE ||
+          func == Keys::LUA_IS_ACTION_PRESSED) {
+        return true;
+      }
+    }
+    return false;
   }
 
   void EntitiesManager::render() {
     renderSystem.render();
-    std::vector<std::shared_ptr<Entity>> high;
-    std::vector<std::shared_ptr<Entity>> normal;
-    std::vector<std::shared_ptr<Entity>> low;
+    for (const auto& bucket : priorityBuckets) {
+      for (Entity* ent : bucket) {
+        if (ent->isActive() || ent->hasAttribute(EntityAttribute::PERMANENT) || ent->hasAttribute(EntityAttribute::PERSISTENT)) {
+          ent->render();
+        }
+      }
+    }
+  }
 
-    for (auto& obj : entityList) {
-      if (!obj) continue;
-      if (obj->hasAttribute(EntityAttribute::HIGH_PRIORITY)) high.push_back(obj);
-      else if (obj->hasAttribute(EntityAttribute::LOW_PRIORITY)) low.push_back(obj);
-      else normal.push_back(obj);
+  void EntitiesManager::refreshEntityPriority(Entity* entity) {
+    if (!entity) return;
+    EntityHandle handle = entity->getHandle();
+    if (isDeferringCommands()) {
+      queueCommand([this, handle]() {
+        if (Entity* target = resolveEntity(handle)) refreshEntityPriority(target);
+      });
+      return;
     }
 
-    auto renderEntity = [&](std::shared_ptr<Entity>& ent) {
-      if (!ent) return;
-      if (ent->isActive() || ent->hasAttribute(EntityAttribute::PERMANENT) || ent->hasAttribute(EntityAttribute::PERSISTENT)) {
-        ent->render();
-      }
-    };
-    for (auto& e : high) renderEntity(e);
-    for (auto& e : normal) renderEntity(e);
-    for (auto& e : low) renderEntity(e);
+    if (!hasEntity(handle) || entitySlots[handle.index].entity.get() != entity) return;
+    EntitySlot& slot = entitySlots[handle.index];
+    if (slot.priority == resolvePriority(entity)) return;
+    removeFromPriorityBucket(slot, entity);
+    addToPriorityBucket(slot, entity);
+  }
+
+  EntitiesManager::PriorityBucket EntitiesManager::resolvePriority(const Entity* entity) {
+    if (entity->hasAttribute(EntityAttribute::HIGH_PRIORITY)) return PRIORITY_HIGH;
+    if (entity->hasAttribute(EntityAttribute::LOW_PRIORITY)) return PRIORITY_LOW;
+    return PRIORITY_NORMAL;
+  }
+
+  void EntitiesManager::addToPriorityBucket(EntitySlot& slot, Entity* entity) {
+    slot.priority = resolvePriority(entity);
+    auto& bucket = priorityBuckets[slot.priority];
+    slot.priorityIndex = bucket.size();
+    bucket.push_back(entity);
+  }
+
+  void EntitiesManager::removeFromPriorityBucket(EntitySlot& slot, Entity* entity) {
+    auto& bucket = priorityBuckets[slot.priority];
+    size_t index = slot.priorityIndex;
+    if (index >= bucket.size() || bucket[index] != entity) return;
+
+    Entity* last = bucket.back();
+    bucket[index] = last;
+    entitySlots[last->getHandle().index].priorityIndex = index;
+    bucket.pop_back();
   }
 
   void EntitiesManager::reset() {
@@ -418,11 +790,10 @@ namespace Project::Entities {
     initialized = false;
     
     objects.clear();
-    updateHighCount = updateNormalCount = updateLowCount = updateToRemoveCount = 0;
-
     entityList.clear();
     entityGroups.clear();
-    entityIndices.clear();
+    discardCommands();
+    releaseEntitySlots();
     idCounters.clear();
     behaviorSystem.clear();
     motionSystem.clear();
@@ -433,15 +804,15 @@ namespace Project::Entities {
     scheduler.addSystem(Components::MOTION, &motionSystem);
     scheduler.addSystem(Components::PHYSICS, &physicsSystem, {Components::MOTION});
     scheduler.addSystem(Components::RENDER, &renderSystem, {Components::PHYSICS});
-    componentArrays.clear();
+    archetypeStorage.clear();
   }
 
   std::vector<std::shared_ptr<Entity>> EntitiesManager::getEntitiesByGroup(const std::string& group) {
     std::vector<std::shared_ptr<Entity>> result;
     auto it = entityGroups.find(group);
     if (it != entityGroups.end()) {
-      for (const auto& id : it->second) {
-        auto ent = getEntity(id);
+      for (const auto& handle : it->second) {
+        auto ent = getEntity(handle);
         if (ent) result.push_back(ent);
       }
     }
@@ -452,33 +823,26 @@ namespace Project::Entities {
     return ObjectsManager<Entity>::count();
   }
 
-  const std::vector<Project::Components::BaseComponent*>& EntitiesManager::getComponentArray(Project::Components::ComponentType type) const {
-    static const std::vector<Project::Components::BaseComponent*> empty;
-    auto it = componentArrays.find(type);
-    return it != componentArrays.end() ? it->second.components : empty;
-  }
+  std::vector<Entity*> EntitiesManager::filterEntitiesByComponents(
+    const std::vector<Project::Components::ComponentType>& types,
+    const std::vector<Project::Components::ComponentType>& excluded) const {
+    ComponentMask include;
+    ComponentMask exclude;
+    for (auto type : types) include.set(static_cast<size_t>(type));
+    for (auto type : excluded) exclude.set(static_cast<size_t>(type));
+
+    const auto& archetypes = archetypeStorage.getArchetypes();
+    const std::vector<size_t>& matches = archetypeStorage.getQueryMatches(include, exclude);
+
+    size_t total = 0;
+    for (size_t index : matches) total += archetypes[index].size();
 
-  std::vector<Entity*> EntitiesManager::filterEntitiesByComponents(const std::vector<Project::Components::ComponentType>& types) const {
-    std::bitset<Constants::BIT_64> mask;
-    for (auto type : types) mask.set(static_cast<size_t>(type));
-    size_t key = mask.to_ullong();
-    auto it = archetypeLookup.find(key);
-    if (it != archetypeLookup.end()) {
-      return archetypes[it->second].entities;
-    }
-    std::unordered_map<Entity*, size_t> counts;
-    for (auto type : types) {
-      auto cit = componentArrays.find(type);
-      if (cit == componentArrays.end()) return {};
-      const auto& comps = cit->second;
-      for (size_t i = 0; i < comps.components.size(); ++i) {
-        auto* owner = comps.owners[i];
-        if (owner) counts[owner]++;
-      }
-    }
     std::vector<Entity*> result;
-    for (auto& [ent, cnt] : counts) {
-      if (cnt == types.size()) result.push_back(ent);
+    result.reserve(total);
+    for (size_t index : matches) {
+      for (const auto& chunk : archetypes[index].getChunks()) {
+        result.insert(result.end(), chunk.getOwners(), chunk.getOwners() + chunk.size());
+      }
     }
     return result;
   }
@@ -531,10 +895,11 @@ namespace Project::Entities {
   void EntitiesManager::clearGroup(const std::string& group) {
     auto it = entityGroups.find(group);
     if (it != entityGroups.end()) {
-      for (const auto& id : it->second) {
-        removeEntity(id);
-      }
+      std::vector<EntityHandle> handles = std::move(it->second);
       entityGroups.erase(it);
+      for (const auto& handle : handles) {
+        removeEntity(handle);
+      }
     }
   }
 
@@ -589,6 +954,8 @@ namespace Project::Entities {
           record(Keys::LUA_DESTROY_ENTITY);
           record(Keys::LUA_DESTROY_ENTITIES);
           record(Keys::LUA_DESTROY_SELF);
+          record(Keys::LUA_ADD_COMPONENT);
+          record(Keys::LUA_REMOVE_COMPONENT);
           record(Keys::LUA_SET_TIMER_ACTIVE);
           record(Keys::LUA_SET_METER_ACTIVE);
           record(Keys::LUA_SET_NETWORK_CONNECTION);
@@ -654,6 +1021,10 @@ namespace Project::Entities {
           entity->registerLuaFunction(func, LuaBindings::lua_destroyEntities, this);
         } else if (func == Keys::LUA_DESTROY_SELF) {
           entity->registerLuaFunction(func, LuaBindings::lua_destroySelf, this);
+        } else if (func == Keys::LUA_ADD_COMPONENT) {
+          entity->registerLuaFunction(func, LuaBindings::lua_addComponent, this);
+        } else if (func == Keys::LUA_REMOVE_COMPONENT) {
+          entity->registerLuaFunction(func, LuaBindings::lua_removeComponent, this);
         } else if (func == Keys::LUA_SET_TIMER_ACTIVE) {
           entity->registerLuaFunction(func, LuaBindings::lua_setTimerActive, this);
         } else if (func == Keys::LUA_SET_METER_ACTIVE) {
@@ -702,47 +1073,71 @@ namespace Project::Entities {
   }
 
   void EntitiesManager::clampEntitiesToRect(const SDL_Rect& rect) {
-    for (auto& entity : entityList) {
-      if (!entity) continue;
-      if (entity->hasAttribute(EntityAttribute::UNBOUNDED)) continue;
+    bool rectChanged = !boundsApplied
+      || rect.x != boundsRect.x || rect.y != boundsRect.y
+      || rect.w != boundsRect.w || rect.h != boundsRect.h;
+
+    if (rectChanged) {
+      boundsRect = rect;
+      boundsApplied = true;
+      for (const auto& entity : entityList) {
+        if (entity) clampEntityToRect(entity, rect);
+      }
+    } else {
+      clampMovedEntitiesToRect(movedEntities, rect);
+      clampMovedEntitiesToRect(motionSystem.getMovedEntities(), rect);
+      clampMovedEntitiesToRect(physicsSystem.getMovedEntities(), rect);
+    }
+    movedEntities.clear();
+  }
 
-      float ex = entity->getX();
-      float ey = entity->getY();
+  void EntitiesManager::clampMovedEntitiesToRect(const std::vector<EntityHandle>& handles, const SDL_Rect& rect) {
+    for (const EntityHandle& handle : handles) {
+      if (!hasEntity(handle)) continue;
+      clampEntityToRect(entitySlots[handle.index].entity, rect);
+    }
+  }
 
-      auto [w, h] = getEntitySize(entity);
+  void EntitiesManager::clampEntityToRect(const std::shared_ptr<Entity>& entity, const SDL_Rect& rect) {
+    if (entity->hasAttribute(EntityAttribute::UNBOUNDED)) return;
 
-      float clampedX = std::clamp(ex, static_cast<float>(rect.x), static_cast<float>(rect.x + rect.w - w));
-      float clampedY = std::clamp(ey, static_cast<float>(rect.y), static_cast<float>(rect.y + rect.h - h));
+    float ex = entity->getX();
+    float ey = entity->getY();
 
-      bool clampedXChanged = clampedX != ex;
-      bool clampedYChanged = clampedY != ey;
+    auto [w, h] = getEntitySize(entity);
 
-      if (clampedXChanged || clampedYChanged) {
-        float newX = clampedXChanged ? clampedX : ex;
-        float newY = clampedYChanged ? clampedY : ey;
+    float clampedX = std::clamp(ex, static_cast<float>(rect.x), static_cast<float>(rect.x + rect.w - w));
+    float clampedY = std::clamp(ey, static_cast<float>(rect.y), static_cast<float>(rect.y + rect.h - h));
 
-        updateEntityPosition(entity, newX, newY);
+    bool clampedXChanged = clampedX != ex;
+    bool clampedYChanged = clampedY != ey;
 
-        if (auto* bbox = entity->getBoundingBoxComponent()) {
-          bbox->getBoxes();
-        }
+    if (clampedXChanged || clampedYChanged) {
+      float newX = clampedXChanged ? clampedX : ex;
+      float newY = clampedYChanged ? clampedY : ey;
 
-        if (auto* motion = dynamic_cast<Project::Components::MotionComponent*>(
-              entity->getComponent(Components::MOTION_COMPONENT))) {
-          float vx = motion->getVelocityX();
-          float vy = motion->getVelocityY();
-          if (clampedXChanged) vx = 0.0f;
-          if (clampedYChanged) vy = 0.0f;
-          motion->setRawVelocity(vx, vy);
-        }
+      updateEntityPosition(entity, newX, newY);
+      entity->consumeBoundsDirty();
 
-        if (auto* physics = entity->getPhysicsComponent()) {
-          float vx = physics->getVelocityX();
-          float vy = physics->getVelocityY();
-          if (clampedXChanged) vx = 0.0f;
-          if (clampedYChanged) vy = 0.0f;
-          physics->setVelocity(vx, vy);
-        }
+      if (auto* bbox = entity->getBoundingBoxComponent()) {
+        bbox->getBoxes();
+      }
+
+      if (auto* motion = dynamic_cast<Project::Components::MotionComponent*>(
+            entity->getComponent(Components::MOTION_COMPONENT))) {
+        float vx = motion->getVelocityX();
+        float vy = motion->getVelocityY();
+        if (clampedXChanged) vx = 0.0f;
+        if (clampedYChanged) vy = 0.0f;
+        motion->setRawVelocity(vx, vy);
+      }
+
+      if (auto* physics = entity->getPhysicsComponent()) {
+        float vx = physics->getVelocityX();
+        float vy = physics->getVelocityY();
+        if (clampedXChanged) vx = 0.0f;
+        if (clampedYChanged) vy = 0.0f;
+        physics->setVelocity(vx, vy);
       }
     }
   }
@@ -870,8 +1265,6 @@ namespace Project::Entities {
     cachedEntities.rehash(0);
 
     entityList.shrink_to_fit();
-    entityIndices.clear();
-    entityIndices.rehash(0);
 
     for (auto& [group, ids] : entityGroups) {
       ids.shrink_to_fit();
@@ -884,6 +1277,22 @@ namespace Project::Entities {
     scriptFunctionCache.rehash(0);
 
     idCounters.rehash(0);
-    updateHighCount = updateNormalCount = updateLowCount = updateToRemoveCount = 0;
+    for (auto& bucket : priorityBuckets) bucket.shrink_to_fit();
+  }
+
+  void EntitiesManager::releaseEntitySlots() {
+    for (auto& bucket : priorityBuckets) bucket.clear();
+    movedEntities.clear();
+    boundsApplied = false;
+    freeEntitySlots.clear();
+    for (size_t i = entitySlots.size(); i > 0; --i) {
+      EntitySlot& slot = entitySlots[i - 1];
+      if (slot.entity) {
+        slot.entity.reset();
+        ++slot.generation;
+      }
+      slot.seenInCamera = false;
+      freeEntitySlots.push_back(static_cast<uint32_t>(i - 1));
+    }
   }
 }
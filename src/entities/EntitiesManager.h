@@ -1,8 +1,15 @@
 #ifndef ENTITIES_MANAGER_H
 #define ENTITIES_MANAGER_H
 
+#include "ArchetypeStorage.h"
+#include "ComponentQuery.h"
 #include "Entity.h"
+#include "EntityCommandBuffer.h"
+#include "EntityHandle.h"
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <lua.hpp>
 #include <memory>
 #include <mutex>
@@ -28,6 +35,7 @@
 #include "systems/system_scheduler/SystemScheduler.h"
 #include "utilities/logs_manager/LogsManager.h"
 #include "utilities/binary_cache/BinaryFileCache.h"
+#include "utilities/thread/TaskGraph.h"
 #include "utilities/thread/ThreadPool.h"
 
 namespace Project::States { class GameState; }
@@ -58,9 +66,39 @@ namespace Project::Entities {
 
       std::string addEntity(std::shared_ptr<Entity> entity, const std::string& id = Project::Libraries::Constants::EMPTY_STRING);
       void removeEntity(const std::string& id);
+      void removeEntity(EntityHandle handle);
+
+      void queueAddEntity(std::shared_ptr<Entity> entity, const std::string& id = Project::Libraries::Constants::EMPTY_STRING);
+      void queueRemoveEntity(const std::string& id);
+      void queueRemoveEntity(EntityHandle handle);
+      void queueAddComponent(EntityHandle handle, const std::string& componentName, Entity::ComponentPtr component);
+      void queueRemoveComponent(EntityHandle handle, const std::string& componentName);
+      void queueCommand(std::function<void()> command);
+      void flushCommands();
+      void refreshEntityPriority(Entity* entity);
+      bool isDeferringCommands() const { return deferringCommands.load(std::memory_order_acquire); }
+      bool isParallelUpdating() const { return parallelUpdating.load(std::memory_order_acquire); }
+
+      template <typename F>
+      void applyToEntity(lua_State* L, const std::shared_ptr<Entity>& entity, F&& apply) {
+        if (!entity) return;
+        if (isParallelUpdating() && entity->getLuaState() != L) {
+          queueCommand([entity, apply = std::forward<F>(apply)]() mutable { apply(); });
+          return;
+        }
+        apply();
+      }
+
+      static void setParallelUpdate(bool enabled) { parallelUpdateEnabled = enabled; }
+      static bool isParallelUpdateEnabled() { return parallelUpdateEnabled; }
+      static std::unique_lock<std::mutex> lockSharedState();
 
       bool hasEntity(const std::string& id);
+      bool hasEntity(EntityHandle handle) const;
       std::shared_ptr<Entity> getEntity(const std::string& id);
+      std::shared_ptr<Entity> getEntity(EntityHandle handle) const;
+      Entity* resolveEntity(EntityHandle handle) const;
+      EntityHandle getEntityHandle(const std::string& id) const;
       const std::unordered_map<std::string, std::shared_ptr<Entity>>& getAllEntities() const { return objects; }
 
       void unloadSceneEntities();
@@ -79,8 +117,20 @@ namespace Project::Entities {
       std::vector<std::shared_ptr<Entity>> getEntitiesByGroup(const std::string& group);
       size_t getEntityCount() const;
       
-      std::vector<Entity*> filterEntitiesByComponents(const std::vector<Project::Components::ComponentType>& types) const;
-      const std::vector<Project::Components::BaseComponent*>& getComponentArray(Project::Components::ComponentType type) const;
+      std::vector<Entity*> filterEntitiesByComponents(
+        const std::vector<Project::Components::ComponentType>& types,
+        const std::vector<Project::Components::ComponentType>& excluded = {}) const;
+
+      template <typename... Components>
+      ComponentQuery<Components...> query(const ComponentMask& exclude = ComponentMask()) const {
+        return ComponentQuery<Components...>(archetypeStorage, exclude);
+      }
+
+      template <typename Component>
+      PayloadQuery<Component> payloadQuery(const ComponentMask& exclude = ComponentMask()) const {
+        return PayloadQuery<Component>(archetypeStorage, exclude);
+      }
+
       void serializeComponentData(const std::string& path) const;
       void deserializeComponentData(const std::string& path);
 
@@ -91,57 +141,23 @@ namespace Project::Entities {
       void warpEntitiesAcrossRect(const SDL_Rect& rect);
       
     private:
-      struct ComponentSoA {
-        std::vector<Project::Components::BaseComponent*> components;
-        std::vector<Entity*> owners;
-        bool reserved = false;
-        void reserve(size_t cap) {
-          if (!reserved) {
-            components.reserve(cap);
-            owners.reserve(cap);
-            reserved = true;
-          }
-        }
-        
-        void add(Project::Components::BaseComponent* comp) {
-          components.push_back(comp);
-          owners.push_back(comp ? comp->getOwner() : nullptr);
-        }
-
-        void remove(Project::Components::BaseComponent* comp) {
-          for (size_t i = 0; i < components.size(); ++i) {
-            if (components[i] == comp) {
-              components[i] = components.back();
-              owners[i] = owners.back();
-              components.pop_back();
-              owners.pop_back();
-              break;
-            }
-          }
-        }
+      enum PriorityBucket : uint8_t {
+        PRIORITY_HIGH,
+        PRIORITY_NORMAL,
+        PRIORITY_LOW,
+        PRIORITY_COUNT
       };
 
-      struct Archetype {
-        std::vector<Entity*> entities;
-        bool reserved = false;
-        void reserve(size_t cap) {
-          if (!reserved) {
-            entities.reserve(cap);
-            reserved = true;
-          }
-        }
-
-        void add(Entity* ent) { entities.push_back(ent); }
-
-        void remove(Entity* ent) {
-          for (size_t i = 0; i < entities.size(); ++i) {
-            if (entities[i] == ent) {
-              entities[i] = entities.back();
-              entities.pop_back();
-              break;
-            }
-          }
-        }
+      struct EntitySlot {
+        std::shared_ptr<Entity> entity;
+        ArchetypeLocation location;
+        size_t listIndex = 0;
+        size_t groupIndex = 0;
+        size_t priorityIndex = 0;
+        PriorityBucket priority = PRIORITY_NORMAL;
+        uint32_t generation = 0;
+        bool seenInCamera = false;
+        bool serialUpdate = false;
       };
 
       Project::Systems::BehaviorSystem behaviorSystem;
@@ -150,34 +166,52 @@ namespace Project::Entities {
       Project::Systems::RenderSystem renderSystem;
       Project::Systems::SystemScheduler scheduler;
 
+      ArchetypeStorage archetypeStorage;
       Project::Utilities::BinaryFileCache persistentFunctionCache;
       Project::Utilities::LogsManager* logsManager = nullptr;
 
-      std::unordered_map<Project::Components::ComponentType, ComponentSoA> componentArrays;
       std::unordered_map<std::string, std::shared_ptr<Entity>> cachedEntities;
-      std::unordered_map<std::string, std::vector<std::string>> entityGroups;
+      std::unordered_map<std::string, std::vector<EntityHandle>> entityGroups;
       std::unordered_map<std::string, std::vector<std::string>> scriptFunctionCache;
-      std::unordered_map<std::string, size_t> entityIndices;
-      std::unordered_map<std::string, size_t> entityArchetypes;
       std::unordered_map<std::string, int> idCounters;
-      std::vector<Archetype> archetypes;
-      std::vector<size_t> archetypeKeys;
-      std::unordered_map<size_t, size_t> archetypeLookup;
-      std::unordered_set<std::string> disposableSeenInCamera;
+      std::vector<EntitySlot> entitySlots;
+      std::vector<uint32_t> freeEntitySlots;
       
       std::vector<std::shared_ptr<Entity>> entityList;
-      std::vector<std::shared_ptr<Entity>> updateHigh;
-      std::vector<std::shared_ptr<Entity>> updateNormal;
-      std::vector<std::shared_ptr<Entity>> updateLow;
-      std::vector<std::string> updateToRemove;
+      std::vector<Entity*> priorityBuckets[PRIORITY_COUNT];
+      std::vector<EntityCommand> pendingCommands;
+      std::vector<EntityHandle> restructuredEntities;
+      std::vector<EntityHandle> movedEntities;
+      SDL_Rect boundsRect{0, 0, 0, 0};
+      bool boundsApplied = false;
+      std::vector<std::unique_ptr<EntityCommandBuffer>> commandBuffers;
+      std::mutex commandBufferMutex;
+      std::atomic<bool> deferringCommands{false};
+      uint64_t commandBufferKey = 0;
+
+      struct ContactDelivery {
+        EntityHandle target;
+        EntityHandle other;
+        Project::Systems::ContactEventType type = Project::Systems::ContactEventType::ENTER;
+      };
+
+      std::vector<ContactDelivery> contactDeliveries;
+      std::vector<std::string> contactTargets;
+
+      Project::Utilities::TaskGraph updateGraph;
+      std::vector<Entity*> parallelEntities;
+      std::vector<Entity*> serialEntities;
+      std::vector<std::vector<Entity*>> scriptLanes;
+      std::unordered_map<lua_State*, size_t> scriptLaneLookup;
+      std::atomic<uint64_t> measuredUpdateNs{0};
+      std::atomic<size_t> measuredUpdateCount{0};
+      std::atomic<bool> parallelUpdating{false};
+      float entityUpdateCostNs = Project::Libraries::Constants::PARALLEL_UPDATE_INITIAL_COST_NS;
+      static bool parallelUpdateEnabled;
       
       Project::States::GameState* gameState = nullptr;
       Project::Platform::Platform* platform = nullptr;
 
-      size_t updateHighCount = 0;
-      size_t updateNormalCount = 0;
-      size_t updateLowCount = 0;
-      size_t updateToRemoveCount = 0;
       
       bool initialized = false;
 
@@ -186,6 +220,27 @@ namespace Project::Entities {
       bool isEntityOutOfBounds(const std::shared_ptr<Entity>& entity) const;
       void updateEntityPosition(const std::shared_ptr<Entity>& entity, float x, float y);
       void optimizeEntitiesImpl();
+      void releaseEntitySlots();
+
+      std::string insertEntity(std::shared_ptr<Entity> entity, const std::string& id);
+      void clampToMapRect(const std::shared_ptr<Entity>& entity);
+      void clampEntityToRect(const std::shared_ptr<Entity>& entity, const SDL_Rect& rect);
+      void clampMovedEntitiesToRect(const std::vector<EntityHandle>& handles, const SDL_Rect& rect);
+      EntityCommandBuffer& getCommandBuffer();
+      void registerComponents(Entity* entity);
+      void unregisterComponents(Entity* entity);
+      void applyComponentCommand(EntityCommand& command);
+      void rebuildRestructuredArchetypes();
+      void discardCommands();
+
+      bool requiresSerialUpdate(Entity* entity) const;
+      void updateBucket(const std::vector<Entity*>& bucket, float deltaTime);
+      void updateBucketParallel(const std::vector<Entity*>& bucket, float deltaTime);
+      void dispatchContactEvents();
+
+      static PriorityBucket resolvePriority(const Entity* entity);
+      void addToPriorityBucket(EntitySlot& slot, Entity* entity);
+      void removeFromPriorityBucket(EntitySlot& slot, Entity* entity);
   };
 }
 
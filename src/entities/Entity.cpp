@@ -38,6 +38,9 @@ namespace Project::Entities {
   Entity::Entity(EntityCategory entityCategory, LogsManager& logsManager, ComponentsFactory& componentsFactory)
   : LuaScriptable(logsManager), componentsFactory(componentsFactory), entityCategory(std::move(entityCategory)) {}
 
+  Entity::Entity(EntityCategory entityCategory, LogsManager& logsManager, ComponentsFactory& componentsFactory, std::shared_ptr<Project::Utilities::LuaStateWrapper> sharedState)
+  : LuaScriptable(logsManager, std::move(sharedState)), componentsFactory(componentsFactory), entityCategory(std::move(entityCategory)) {}
+
   Entity::~Entity() = default;
 
   void Entity::initialize() {
@@ -154,6 +157,35 @@ namespace Project::Entities {
     return true;
   }
 
+  bool Entity::instantiate(const EntityBlueprint& blueprint) {
+    if (blueprint.scripted) {
+      if (!LuaScriptable::attachLuaScript(blueprint.scriptPath)) {
+        return false;
+      }
+    } else {
+      scriptPath = blueprint.scriptPath;
+      luaStateWrapper.setGlobalNumber(Keys::X, blueprint.x);
+      luaStateWrapper.setGlobalNumber(Keys::Y, blueprint.y);
+      luaStateWrapper.setGlobalNumber(Keys::Z, blueprint.z);
+    }
+
+    data.global = blueprint.global;
+    data.active = blueprint.active;
+    data.group = blueprint.group;
+    attributes.insert(blueprint.attributes.begin(), blueprint.attributes.end());
+
+    for (const auto& [componentName, prototype] : blueprint.components) {
+      ComponentPtr component = componentsFactory.clone(*prototype);
+      if (!component) {
+        logsManager.logError("Failed to clone component: " + componentName);
+        return false;
+      }
+      addComponent(componentName, std::move(component));
+    }
+
+    return true;
+  }
+
   void Entity::addComponent(const std::string& componentName, ComponentPtr component) {
     if (!component) return;
 
@@ -189,9 +221,10 @@ namespace Project::Entities {
       meter->setEntityReference(this);
     }
 
-    if (auto* motion = dynamic_cast<Components::MotionComponent*>(component.get())) {
-      motion->setEntityReference(this);
-      motion->onAttach();
+    if (auto* motionComp = dynamic_cast<Components::MotionComponent*>(component.get())) {
+      motionComp->setEntityReference(this);
+      motionComp->onAttach();
+      motion = motionComp;
     }
 
     if (auto* numeric = dynamic_cast<Components::NumericComponent*>(component.get())) {
@@ -243,9 +276,7 @@ namespace Project::Entities {
     }
     if (entitiesManager) {
       auto* compPtr = components[componentName].get();
-      if (auto* motion = dynamic_cast<Components::MotionComponent*>(compPtr)) {
-        entitiesManager->getMotionSystem().add(motion);
-      } else if (auto* phys = dynamic_cast<Components::PhysicsComponent*>(compPtr)) {
+      if (auto* phys = dynamic_cast<Components::PhysicsComponent*>(compPtr)) {
         entitiesManager->getPhysicsSystem().add(phys);
       } else if (auto* gfx = dynamic_cast<Components::GraphicsComponent*>(compPtr)) {
         entitiesManager->getRenderSystem().add(gfx);
@@ -266,6 +297,7 @@ namespace Project::Entities {
       bbox = nullptr;
     }
     if (ptr == gfx) gfx = nullptr;
+    if (ptr == motion) motion = nullptr;
     if (ptr == network) network = nullptr;
     if (ptr == physics) physics = nullptr;
 
@@ -278,9 +310,7 @@ namespace Project::Entities {
     }
 
     if (entitiesManager) {
-      if (auto* motion = dynamic_cast<Components::MotionComponent*>(ptr)) {
-        entitiesManager->getMotionSystem().remove(motion);
-      } else if (auto* phys = dynamic_cast<Components::PhysicsComponent*>(ptr)) {
+      if (auto* phys = dynamic_cast<Components::PhysicsComponent*>(ptr)) {
         entitiesManager->getPhysicsSystem().remove(phys);
       } else if (auto* gfx = dynamic_cast<Components::GraphicsComponent*>(ptr)) {
         entitiesManager->getRenderSystem().remove(gfx);
@@ -291,6 +321,10 @@ namespace Project::Entities {
     componentOrder.erase(std::remove(componentOrder.begin(), componentOrder.end(), componentName), componentOrder.end());
   }
 
+  Entity::ComponentPtr Entity::createComponent(const std::string& componentName, const std::string& tableName) {
+    return componentsFactory.create(componentName, luaStateWrapper, tableName);
+  }
+
   bool Entity::hasComponent(const std::string& componentName) const {
     return components.find(componentName) != components.end();
   }
@@ -317,6 +351,20 @@ namespace Project::Entities {
     return result;
   }
 
+  void Entity::addAttribute(EntityAttribute attribute) {
+    bool inserted = attributes.insert(attribute).second;
+    if (inserted && entitiesManager && (attribute == EntityAttribute::HIGH_PRIORITY || attribute == EntityAttribute::LOW_PRIORITY)) {
+      entitiesManager->refreshEntityPriority(this);
+    }
+  }
+
+  void Entity::removeAttribute(EntityAttribute attribute) {
+    bool erased = attributes.erase(attribute) > 0;
+    if (erased && entitiesManager && (attribute == EntityAttribute::HIGH_PRIORITY || attribute == EntityAttribute::LOW_PRIORITY)) {
+      entitiesManager->refreshEntityPriority(this);
+    }
+  }
+
   bool Entity::canSee(const Project::Entities::Entity* target) const {
     auto comps = getComponentsByType(Project::Components::ComponentType::VISION);
     for (auto* base : comps) {
@@ -2,9 +2,11 @@
 #define ENTITY_H
 
 #include "EntityAttribute.h"
+#include "EntityBlueprint.h"
 #include "EntityCategory.h"
 #include "EntityData.h"
 
+#include <atomic>
 #include <functional>
 #include <lua.hpp>
 #include <memory>
@@ -28,6 +30,10 @@ namespace Project::Factories {
   class ComponentsFactory;
 }
 
+namespace Project::Components {
+  class MotionComponent;
+}
+
 namespace Project::Entities {
   class EntitiesManager;
   class Entity : public Project::Utilities::LuaScriptable, public Project::Interfaces::Renderable, public Project::Interfaces::Updatable {
@@ -35,6 +41,10 @@ namespace Project::Entities {
     explicit Entity(EntityCategory entityCategory, 
       Project::Utilities::LogsManager& logsManager, 
       Project::Factories::ComponentsFactory& componentsFactory);
+    Entity(EntityCategory entityCategory,
+      Project::Utilities::LogsManager& logsManager,
+      Project::Factories::ComponentsFactory& componentsFactory,
+      std::shared_ptr<Project::Utilities::LuaStateWrapper> sharedState);
     virtual ~Entity();
 
     const EntityData& getData() const { return data; }
@@ -55,6 +65,9 @@ namespace Project::Entities {
     const std::string& getEntityID() const { return data.id; }
     void setEntityID(const std::string& _id) { data.id = _id; }
 
+    const EntityHandle& getHandle() const { return data.handle; }
+    void setHandle(const EntityHandle& _handle) { data.handle = _handle; }
+
     const std::string& getEntityClass() const { return data.entityClass; }
     void setEntityClass(const std::string& _class) { data.entityClass = _class; }
 
@@ -76,21 +89,24 @@ namespace Project::Entities {
     }
     
     bool attachLuaScript(const std::string& scriptPath);
+    bool instantiate(const EntityBlueprint& blueprint);
     
     using ComponentPtr = std::unique_ptr<Project::Components::BaseComponent, std::function<void(Project::Components::BaseComponent*)>>;
     void addComponent(const std::string& componentName, ComponentPtr component);    
     
     void removeComponent(const std::string& componentName);
+    ComponentPtr createComponent(const std::string& componentName, const std::string& tableName);
     bool hasComponent(const std::string& componentName) const;
 
-    void addAttribute(EntityAttribute attribute) { attributes.insert(attribute); }
-    void removeAttribute(EntityAttribute attribute) { attributes.erase(attribute); }
+    void addAttribute(EntityAttribute attribute);
+    void removeAttribute(EntityAttribute attribute);
     bool hasAttribute(EntityAttribute attribute) const { return attributes.count(attribute) > 0; }
     const std::unordered_set<EntityAttribute>& getAttributes() const { return attributes; }
 
     Project::Components::BaseComponent* getComponent(const std::string& componentName);
     Project::Components::BoundingBoxComponent* getBoundingBoxComponent() const { return bbox; }
     Project::Components::GraphicsComponent* getGraphicsComponent() const { return gfx; }
+    Project::Components::MotionComponent* getMotionComponent() const { return motion; }
     Project::Components::NetworkComponent* getNetworkComponent() const { return network; }
     Project::Components::PhysicsComponent* getPhysicsComponent() const { return physics; }
 
@@ -104,8 +120,11 @@ namespace Project::Entities {
     bool isGlobal() const { return data.global; }
     void setGlobal(bool _value) { data.global = _value; }
 
-    void setPosition(float _newX, float _newY) { data.x = _newX; data.y = _newY; }
-    void setPosition(float _newX, float _newY, float _newZ) { data.x = _newX; data.y = _newY; data.z = _newZ; }
+    void setPosition(float _newX, float _newY) { data.x = _newX; data.y = _newY; boundsDirty.store(true, std::memory_order_release); }
+    void setPosition(float _newX, float _newY, float _newZ) { data.x = _newX; data.y = _newY; data.z = _newZ; boundsDirty.store(true, std::memory_order_release); }
+
+    // Behavior lanes write the flag while Physics and Render consume it, so it is atomic.
+    bool consumeBoundsDirty() { return boundsDirty.exchange(false, std::memory_order_acq_rel); }
 
     float getX() const { return data.x; }
     float getY() const { return data.y; }
@@ -114,6 +133,7 @@ namespace Project::Entities {
   private:
     Project::Components::BoundingBoxComponent* bbox = nullptr;
     Project::Components::GraphicsComponent* gfx = nullptr;
+    Project::Components::MotionComponent* motion = nullptr;
     Project::Components::NetworkComponent* network = nullptr;
     Project::Components::PhysicsComponent* physics = nullptr;
     Project::Factories::ComponentsFactory& componentsFactory;
@@ -126,6 +146,7 @@ namespace Project::Entities {
     std::vector<std::string> componentOrder;
         
     Project::Entities::EntitiesManager* entitiesManager = nullptr;
+    std::atomic<bool> boundsDirty{true};
   };
 }
 
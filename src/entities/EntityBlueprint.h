@@ -0,0 +1,28 @@
+#ifndef ENTITY_BLUEPRINT_H
+#define ENTITY_BLUEPRINT_H
+
+#include "EntityAttribute.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "components/BaseComponent.h"
+
+namespace Project::Entities {
+  struct EntityBlueprint {
+    std::string scriptPath;
+    std::string group;
+    std::vector<EntityAttribute> attributes;
+    std::vector<std::pair<std::string, const Project::Components::BaseComponent*>> components;
+    float x{0.0f};
+    float y{0.0f};
+    float z{0.0f};
+    bool active{true};
+    bool global{false};
+    bool scripted{true};
+    bool compiled{false};
+  };
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include "EntityCommandBuffer.h"
+
+#include <iterator>
+#include <utility>
+
+namespace Project::Entities {
+  void EntityCommandBuffer::create(std::shared_ptr<Entity> entity, const std::string& id) {
+    if (!entity) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::CREATE;
+    command.entity = std::move(entity);
+    command.name = id;
+  }
+
+  void EntityCommandBuffer::destroy(EntityHandle handle) {
+    if (!handle.isValid()) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::DESTROY;
+    command.handle = handle;
+  }
+
+  void EntityCommandBuffer::destroy(const std::string& id) {
+    if (id.empty()) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::DESTROY;
+    command.name = id;
+  }
+
+  void EntityCommandBuffer::addComponent(EntityHandle handle, const std::string& componentName, Entity::ComponentPtr component) {
+    if (!handle.isValid() || !component) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::ADD_COMPONENT;
+    command.handle = handle;
+    command.name = componentName;
+    command.component = std::move(component);
+  }
+
+  void EntityCommandBuffer::removeComponent(EntityHandle handle, const std::string& componentName) {
+    if (!handle.isValid()) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::REMOVE_COMPONENT;
+    command.handle = handle;
+    command.name = componentName;
+  }
+
+  void EntityCommandBuffer::call(std::function<void()> callback) {
+    if (!callback) return;
+    EntityCommand& command = commands.emplace_back();
+    command.type = EntityCommandType::DEFERRED_CALL;
+    command.callback = std::move(callback);
+  }
+
+  void EntityCommandBuffer::drainInto(std::vector<EntityCommand>& out) {
+    out.insert(out.end(), std::make_move_iterator(commands.begin()), std::make_move_iterator(commands.end()));
+    commands.clear();
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef ENTITY_COMMAND_BUFFER_H
+#define ENTITY_COMMAND_BUFFER_H
+
+#include "Entity.h"
+#include "EntityHandle.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Project::Entities {
+  enum class EntityCommandType {
+    CREATE,
+    DESTROY,
+    ADD_COMPONENT,
+    REMOVE_COMPONENT,
+    DEFERRED_CALL
+  };
+
+  struct EntityCommand {
+    EntityCommandType type = EntityCommandType::CREATE;
+    EntityHandle handle;
+    std::shared_ptr<Entity> entity;
+    std::string name;
+    Entity::ComponentPtr component;
+    std::function<void()> callback;
+  };
+
+  class EntityCommandBuffer {
+  public:
+    void create(std::shared_ptr<Entity> entity, const std::string& id);
+    void destroy(EntityHandle handle);
+    void destroy(const std::string& id);
+    void addComponent(EntityHandle handle, const std::string& componentName, Entity::ComponentPtr component);
+    void removeComponent(EntityHandle handle, const std::string& componentName);
+    void call(std::function<void()> callback);
+
+    void drainInto(std::vector<EntityCommand>& out);
+    void clear() { commands.clear(); }
+
+    bool empty() const { return commands.empty(); }
+    size_t size() const { return commands.size(); }
+
+  private:
+    std::vector<EntityCommand> commands;
+  };
+}
+
+#endif
@@ -1,10 +1,13 @@
 #ifndef ENTITY_DATA_H
 #define ENTITY_DATA_H
 
+#include "EntityHandle.h"
+
 #include <string>
 
 namespace Project::Entities {
   struct EntityData {
+    EntityHandle handle;
     std::string id;
     std::string entityClass;
     std::string group;
@@ -0,0 +1,43 @@
+#ifndef ENTITY_HANDLE_H
+#define ENTITY_HANDLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Entities {
+  struct EntityHandle {
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    EntityHandle() = default;
+    EntityHandle(uint32_t indexVal, uint32_t generationVal)
+      : index(indexVal), generation(generationVal) {}
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    uint64_t toKey() const { return (static_cast<uint64_t>(generation) << Project::Libraries::Constants::BIT_32) | index; }
+
+    static EntityHandle fromKey(uint64_t key) {
+      return EntityHandle(static_cast<uint32_t>(key), static_cast<uint32_t>(key >> Project::Libraries::Constants::BIT_32));
+    }
+
+    bool operator==(const EntityHandle& other) const {
+      return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+  };
+
+  struct EntityHandleHash {
+    size_t operator()(const EntityHandle& handle) const {
+      return std::hash<uint64_t>{}(handle.toKey());
+    }
+  };
+}
+
+#endif
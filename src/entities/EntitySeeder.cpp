@@ -43,11 +43,11 @@ namespace Project::Entities {
     for (auto& [k, chunk] : chunks) {
       int cx = static_cast<int>(k >> Constants::BIT_32);
       int cy = static_cast<int>(static_cast<unsigned int>(k));
-      auto it = chunk.ids.begin();
-      while (it != chunk.ids.end()) {
-        auto ent = manager.getEntity(*it);
+      auto it = chunk.handles.begin();
+      while (it != chunk.handles.end()) {
+        Entity* ent = manager.resolveEntity(*it);
         if (!ent) {
-          it = chunk.ids.erase(it);
+          it = chunk.handles.erase(it);
           continue;
         }
 
@@ -56,8 +56,8 @@ namespace Project::Entities {
         long long nk = key(ecx, ecy);
 
         if (nk != k) {
-          chunks[nk].ids.push_back(*it);
-          it = chunk.ids.erase(it);
+          chunks[nk].handles.push_back(*it);
+          it = chunk.handles.erase(it);
         } else {
           ++it;
         }
@@ -186,8 +186,8 @@ namespace Project::Entities {
         }
 
         bool entityVisible = false;
-        for (const std::string& id : chunk.ids) {
-          auto ent = manager.getEntity(id);
+        for (const EntityHandle& handle : chunk.handles) {
+          Entity* ent = manager.resolveEntity(handle);
           if (!ent) continue;
           SDL_FRect r{ent->getX(), ent->getY(), 1.0f, 1.0f};
           if (auto* gfx = ent->getGraphicsComponent()) {
@@ -292,7 +292,7 @@ namespace Project::Entities {
   void EntitySeeder::loadChunk(int cx, int cy) {
     long long k = key(cx, cy);
     Chunk& chunk = chunks[k];
-    if (!chunk.ids.empty()) return;
+    if (!chunk.handles.empty()) return;
     if (manager.getEntityCount() >= maxSeededEntities) return;
 
     bool bounded = false;
@@ -457,8 +457,8 @@ namespace Project::Entities {
           int ecx = static_cast<int>(existingKey >> Constants::BIT_32);
           int ecy = static_cast<int>(static_cast<unsigned int>(existingKey));
           if (std::abs(ecx - cx) > 1 || std::abs(ecy - cy) > 1) continue;
-          for (const std::string& eid : existingChunk.ids) {
-            auto ent = manager.getEntity(eid);
+          for (const EntityHandle& handle : existingChunk.handles) {
+            Entity* ent = manager.resolveEntity(handle);
             if (!ent) continue;
             SDL_FRect r{ent->getX(), ent->getY(), 0.0f, 0.0f};
             if (auto* gfx = ent->getGraphicsComponent()) {
@@ -479,8 +479,8 @@ namespace Project::Entities {
         size_t newId = idCounter.fetch_add(1);
         std::string id = tmpl + std::string(Constants::SEED) + std::to_string(newId);
         std::shared_ptr<Entity> shared = std::move(entity);
-        std::string finalId = manager.addEntity(shared, id);
-        it->second.ids.push_back(finalId);
+        manager.addEntity(shared, id);
+        it->second.handles.push_back(shared->getHandle());
       });
     }
   }
@@ -488,8 +488,8 @@ namespace Project::Entities {
   void EntitySeeder::unloadChunk(long long k) {
     auto it = chunks.find(k);
     if (it == chunks.end()) return;
-    for (const std::string& id : it->second.ids) {
-      manager.removeEntity(id);
+    for (const EntityHandle& handle : it->second.handles) {
+      manager.removeEntity(handle);
     }
     chunks.erase(it);
   }
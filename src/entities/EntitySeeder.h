@@ -2,6 +2,7 @@
 #define ENTITY_SEEDER_H
 
 #include "ChunkSize.h"
+#include "EntityHandle.h"
 
 #include <atomic>
 #include <cstddef>
@@ -53,7 +54,7 @@ namespace Project::Entities {
 
   private:
     struct Chunk {
-      std::vector<std::string> ids;
+      std::vector<EntityHandle> handles;
     };
 
     ChunkSize chunkSize{
@@ -47,6 +47,17 @@ namespace Project::Factories {
   namespace Constants = Project::Libraries::Constants;
   namespace Keys = Project::Libraries::Keys;
 
+  template <typename T, typename Pool, typename... Args>
+  static ComponentsFactory::ComponentPtr clonePrototype(Pool& pool, const BaseComponent& prototype, Args&&... args) {
+    auto component = pool.acquire(std::forward<Args>(args)...);
+    component->copyFrom(static_cast<const T&>(prototype));
+    component->setActive(prototype.isActive());
+    component->setClass(prototype.getClass());
+
+    ComponentsFactory::ComponentPtr base(component.release(), [d = component.get_deleter()](BaseComponent* b){ d(static_cast<T*>(b)); });
+    return base;
+  }
+
   ComponentsFactory::ComponentsFactory(LogsManager& logsManager, ConfigReader& configReader,ResourcesHandler& resourcesHandler)
   : logsManager(logsManager), configReader(configReader),
     resourcesHandler(resourcesHandler),
@@ -293,6 +304,61 @@ namespace Project::Factories {
     }
   }
 
+  ComponentsFactory::ComponentPtr ComponentsFactory::clone(const BaseComponent& prototype) {
+    if (!isCloneable(prototype)) {
+      return nullptr;
+    }
+
+    switch (prototype.getType()) {
+      case ComponentType::BOUNDING_BOX:
+        return clonePrototype<BoundingBoxComponent>(ComponentPool<BoundingBoxComponent>::getInstance(), prototype, logsManager, renderer, keyHandler, Constants::DEFAULT_DEBUG_TEXT_COLOR);
+      case ComponentType::GRAPHICS:
+        return clonePrototype<GraphicsComponent>(ComponentPool<GraphicsComponent>::getInstance(), prototype, renderer, &resourcesHandler, *assetsManager, logsManager);
+      case ComponentType::LIGHT:
+        return clonePrototype<LightComponent>(ComponentPool<LightComponent>::getInstance(), prototype, renderer, logsManager);
+      case ComponentType::METER:
+        return clonePrototype<MeterComponent>(ComponentPool<MeterComponent>::getInstance(), prototype, renderer, logsManager);
+      case ComponentType::MOTION:
+        return clonePrototype<MotionComponent>(MotionComponentPool::getInstance(), prototype, logsManager, keyHandler);
+      case ComponentType::NUMERIC:
+        return clonePrototype<NumericComponent>(ComponentPool<NumericComponent>::getInstance(), prototype, logsManager);
+      case ComponentType::PHYSICS:
+        return clonePrototype<PhysicsComponent>(ComponentPool<PhysicsComponent>::getInstance(), prototype, logsManager);
+      case ComponentType::PORTAL:
+        return clonePrototype<PortalComponent>(ComponentPool<PortalComponent>::getInstance(), prototype, logsManager);
+      case ComponentType::SPAWNER:
+        return clonePrototype<SpawnerComponent>(ComponentPool<SpawnerComponent>::getInstance(), prototype, logsManager);
+      case ComponentType::TIMER:
+        return clonePrototype<TimerComponent>(ComponentPool<TimerComponent>::getInstance(), prototype, logsManager);
+      case ComponentType::TRANSFORM:
+        return clonePrototype<TransformComponent>(TransformComponentPool::getInstance(), prototype, logsManager);
+      default:
+        return nullptr;
+    }
+  }
+
+  bool ComponentsFactory::isCloneable(const BaseComponent& prototype) const {
+    if (!renderer) return false;
+
+    switch (prototype.getType()) {
+      case ComponentType::GRAPHICS:
+        return assetsManager && static_cast<const GraphicsComponent&>(prototype).isCloneable();
+      case ComponentType::BOUNDING_BOX:
+      case ComponentType::LIGHT:
+      case ComponentType::METER:
+      case ComponentType::MOTION:
+      case ComponentType::NUMERIC:
+      case ComponentType::PHYSICS:
+      case ComponentType::PORTAL:
+      case ComponentType::SPAWNER:
+      case ComponentType::TIMER:
+      case ComponentType::TRANSFORM:
+        return true;
+      default:
+        return false;
+    }
+  }
+
   // Getters and Setters Section
   void ComponentsFactory::setRenderer(SDL_Renderer* renderer) {
     this->renderer = renderer;
@@ -54,6 +54,8 @@ namespace Project::Factories {
     void configurePools();
     
     ComponentPtr create(const std::string& componentName, Project::Utilities::LuaStateWrapper& luaStateWrapper, const std::string& tableName);
+    ComponentPtr clone(const Project::Components::BaseComponent& prototype);
+    bool isCloneable(const Project::Components::BaseComponent& prototype) const;
 
     void setRenderer(SDL_Renderer* renderer);
     void setCameraHandler(Project::Handlers::CameraHandler* _handler);
@@ -12,6 +12,7 @@ namespace Project::Factories {
   using Project::Utilities::LogsManager;
   using Project::Utilities::ConfigReader;
   using Project::Entities::Entity;
+  using Project::Entities::EntityBlueprint;
   using Project::Entities::EntityCategory;
   using Project::Factories::EntitiesFactory;
   using Project::States::GameStateManager;
@@ -26,10 +27,13 @@ namespace Project::Factories {
       componentsFactory(componentsFactory), gameStateManager(gameStateManager) {
         int limit = configReader.getIntValue(Keys::POOLS_SECTION, Keys::POOL_ENTITY_MAX, Constants::DEFAULT_COMPONENT_SIZE);
         Project::Helpers::EntityPool::getInstance().setMaxSize(static_cast<size_t>(limit));
+        sharedScriptVM = configReader.getBoolValue(Keys::SCRIPTING_SECTION, Keys::SCRIPTING_SHARED_VM, true);
       }
 
   EntitiesFactory::~EntitiesFactory() {
+    entityBlueprints.clear();
     entityTemplates.clear();
+    sharedScriptStates.clear();
   }
 
   EntitiesFactory::EntityPtr EntitiesFactory::createEntityFromLua(const std::string& scriptPath) {
@@ -43,6 +47,7 @@ namespace Project::Factories {
       return nullptr;
     }
 
+    entityBlueprints.erase(name);
     entityTemplates[name] = std::move(entity);
     entityScriptPaths[name] = scriptPath;
     return cloneEntity(name);
@@ -67,18 +72,25 @@ namespace Project::Factories {
     }
 
     EntityCategory category = it->second->getEntityCategory();
-    EntityPtr clone = Project::Helpers::EntityPool::getInstance().make_unique(category, logsManager, componentsFactory);
+    auto pathIt = entityScriptPaths.find(entityName);
+    std::string scriptPath = (pathIt != entityScriptPaths.end()) ? pathIt->second : "";
+    if (scriptPath.empty()) {
+      logsManager.logWarning("Script path for entity '" + entityName + "' not found. Using default path.");
+      scriptPath = "scripts/entities/" + entityName + ".entity.lua";
+    }
+
+    EntityPtr clone = makeEntity(category, scriptPath);
     clone->setEntityName(entityName);
 
     lua_State* templateState = it->second->getLuaState();
     if (templateState) {
-      auto pathIt = entityScriptPaths.find(entityName);
-      std::string scriptPath = (pathIt != entityScriptPaths.end()) ? pathIt->second : "";
-      if (!scriptPath.empty()) {
-        clone->attachLuaScript(scriptPath);
+      const EntityBlueprint& blueprint = compileBlueprint(entityName, *it->second, scriptPath);
+      if (blueprint.compiled) {
+        if (logsManager.checkAndLogError(!clone->instantiate(blueprint), "Failed to instantiate entity blueprint: " + entityName)) {
+          return nullptr;
+        }
       } else {
-        logsManager.logWarning("Script path for entity '" + entityName + "' not found. Using default path.");
-        clone->attachLuaScript("scripts/entities/" + entityName + ".entity.lua");
+        clone->attachLuaScript(scriptPath);
       }
 
       lua_State* L = clone->getLuaState();
@@ -94,6 +106,36 @@ namespace Project::Factories {
     return clone;
   }
 
+  const EntityBlueprint& EntitiesFactory::compileBlueprint(const std::string& entityName, Entity& entityTemplate, const std::string& scriptPath) {
+    auto it = entityBlueprints.find(entityName);
+    if (it != entityBlueprints.end()) {
+      return it->second;
+    }
+
+    EntityBlueprint& blueprint = entityBlueprints[entityName];
+    blueprint.scriptPath = scriptPath;
+    for (const std::string& componentName : entityTemplate.listComponentNames()) {
+      const Project::Components::BaseComponent* prototype = entityTemplate.getComponent(componentName);
+      if (!prototype || !componentsFactory.isCloneable(*prototype)) {
+        blueprint.components.clear();
+        return blueprint;
+      }
+      blueprint.components.emplace_back(componentName, prototype);
+    }
+
+    Project::Utilities::LuaStateWrapper& lua = entityTemplate.getLuaStateWrapper();
+    blueprint.group = entityTemplate.getGroup();
+    blueprint.attributes.assign(entityTemplate.getAttributes().begin(), entityTemplate.getAttributes().end());
+    blueprint.x = lua.getGlobalNumber(Keys::X, 0.0f);
+    blueprint.y = lua.getGlobalNumber(Keys::Y, 0.0f);
+    blueprint.z = lua.getGlobalNumber(Keys::Z, 0.0f);
+    blueprint.active = entityTemplate.isActive();
+    blueprint.global = entityTemplate.isGlobal();
+    blueprint.scripted = lua.hasScopedFunctions();
+    blueprint.compiled = true;
+    return blueprint;
+  }
+
   EntitiesFactory::EntityPtr EntitiesFactory::loadEntityTemplateFromLua(const std::string& scriptPath) {
     Project::Utilities::LuaStateWrapper lua(logsManager);
     if (!lua.loadScript(scriptPath)) {
@@ -140,9 +182,7 @@ namespace Project::Factories {
 
     EntityCategory category = EntityCategory::ENVIRONMENT;
 
-    EntityPtr entity = Project::Helpers::EntityPool::getInstance().make_unique(
-      category, logsManager, componentsFactory
-    );
+    EntityPtr entity = makeEntity(category, scriptPath);
 
     if (logsManager.checkAndLogError(!entity->attachLuaScript(scriptPath), "Failed to attach Lua script: " + scriptPath)) {
       return nullptr;
@@ -152,4 +192,18 @@ namespace Project::Factories {
     entityScriptPaths[name] = scriptPath;
     return entity;
   }
+
+  EntitiesFactory::EntityPtr EntitiesFactory::makeEntity(EntityCategory category, const std::string& scriptPath) {
+    auto& pool = Project::Helpers::EntityPool::getInstance();
+    if (!sharedScriptVM) {
+      return pool.make_unique(category, logsManager, componentsFactory);
+    }
+
+    auto& shared = sharedScriptStates[scriptPath];
+    if (!shared) {
+      shared = std::make_shared<Project::Utilities::LuaStateWrapper>(logsManager);
+      shared->registerFunction(Keys::LUA_FUNC_PRINT, Project::Utilities::LuaStateWrapper::luaPrintRedirect);
+    }
+    return pool.make_unique(category, logsManager, componentsFactory, shared);
+  }
 }
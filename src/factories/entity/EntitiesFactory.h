@@ -2,14 +2,17 @@
 #define ENTITY_FACTORY_H
 
 #include <lua.hpp>
+#include <memory>
 #include <unordered_map>
 
 #include "entities/Entity.h"
+#include "entities/EntityBlueprint.h"
 #include "entities/EntitiesManager.h"
 #include "factories/component/ComponentsFactory.h"
 #include "helpers/entity_pool/EntityPool.h"
 #include "utilities/logs_manager/LogsManager.h"
 #include "utilities/config_reader/ConfigReader.h"
+#include "utilities/lua_state_wrapper/LuaStateWrapper.h"
 
 namespace Project::States { class GameStateManager; }
 namespace Project::Factories {  
@@ -40,8 +43,13 @@ namespace Project::Factories {
 
     std::unordered_map<std::string, std::string> entityScriptPaths;
     std::unordered_map<std::string, EntityPtr> entityTemplates;
+    std::unordered_map<std::string, Project::Entities::EntityBlueprint> entityBlueprints;
+    std::unordered_map<std::string, std::shared_ptr<Project::Utilities::LuaStateWrapper>> sharedScriptStates;
+    bool sharedScriptVM = true;
 
     EntityPtr loadEntityTemplateFromLua(const std::string& scriptPath);
+    const Project::Entities::EntityBlueprint& compileBlueprint(const std::string& entityName, Project::Entities::Entity& entityTemplate, const std::string& scriptPath);
+    EntityPtr makeEntity(Project::Entities::EntityCategory category, const std::string& scriptPath);
   };
 }
 
@@ -4,6 +4,7 @@
 
 #include "libraries/categories/Categories.h"
 #include "libraries/keys/Keys.h"
+#include "utilities/spatial/BroadPhaseTypeResolver.h"
 
 namespace Project::Factories {
   using Project::Layers::Layer;
@@ -50,6 +51,7 @@ namespace Project::Factories {
     clone->setActive(tmpl.isActive());
     clone->setInteractable(tmpl.isInteractable());
     clone->setFollowCamera(tmpl.followsCamera());
+    clone->setBroadPhaseType(tmpl.getBroadPhaseType());
     return clone;
   }
 
@@ -90,6 +92,11 @@ namespace Project::Factories {
     layer->setFollowCamera(follow);
     layer->setInteractable(interact);
 
+    std::string broadPhase = lua.getGlobalString(Keys::BROAD_PHASE);
+    if (!broadPhase.empty()) {
+      layer->setBroadPhaseType(Project::Utilities::BroadPhaseTypeResolver::resolve(broadPhase, layer->getBroadPhaseType()));
+    }
+
     return layer;
   }
 }
\ No newline at end of file
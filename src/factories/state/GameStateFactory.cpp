@@ -10,6 +10,7 @@
 #include "layers/LayersManager.h"
 #include "layers/LayerCategory.h"
 #include "states/DimensionModeResolver.h"
+#include "utilities/spatial/BroadPhaseTypeResolver.h"
 
 namespace Project::Factories {
   using Project::Utilities::LogsManager;
@@ -23,6 +24,8 @@ namespace Project::Factories {
   using Project::States::GameStateCategory;
   using Project::States::GameStateCategoryResolver;
   using Project::States::GameStateManager;
+  using Project::Systems::PhysicsSystem;
+  using Project::Utilities::BroadPhaseTypeResolver;
 
   namespace Keys = Project::Libraries::Keys;
   namespace Layers = Project::Libraries::Categories::Layers;
@@ -92,6 +95,13 @@ namespace Project::Factories {
     auto entitiesMgr = std::make_shared<Project::Entities::EntitiesManager>();
     entitiesMgr->setPlatform(&platform);
     entitiesMgr->setLogsManager(&logsManager);
+
+    lua_getglobal(L, Keys::BROAD_PHASE);
+    if (lua_isstring(L, -1)) {
+      auto& physicsSystem = entitiesMgr->getPhysicsSystem();
+      physicsSystem.setBroadPhaseType(BroadPhaseTypeResolver::resolve(lua_tostring(L, -1), PhysicsSystem::getDefaultBroadPhaseType()));
+    }
+    lua_pop(L, 1);
     newState->setEntitiesManager(std::move(entitiesMgr));
     newState->setGlobalEntitiesManager(gameStateManager.getGlobalEntitiesManager());
     newState->setEntitiesFactory(&entitiesFactory);
@@ -0,0 +1,210 @@
+#include "TileChunkCache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Handlers {
+  namespace Constants = Project::Libraries::Constants;
+
+  static SDL_BlendMode premultipliedBlendMode() {
+    static const SDL_BlendMode mode = SDL_ComposeCustomBlendMode(
+      SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+      SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+    return mode;
+  }
+
+  TileChunkCache::TileChunkCache(SDL_Renderer* renderer)
+    : renderer(renderer), chunkSize(Constants::TILE_CHUNK_SIZE) {
+    SDL_AddEventWatch(&TileChunkCache::handleRenderEvent, this);
+  }
+
+  TileChunkCache::~TileChunkCache() {
+    SDL_DelEventWatch(&TileChunkCache::handleRenderEvent, this);
+    clear();
+  }
+
+  void TileChunkCache::add(const std::vector<BuiltTile>& tiles, size_t firstIndex) {
+    for (size_t i = firstIndex; i < tiles.size(); ++i) {
+      const BuiltTile& tile = tiles[i];
+      if (!tile.texture || tile.dest.w <= 0 || tile.dest.h <= 0) continue;
+
+      const int minX = toChunk(tile.dest.x);
+      const int minY = toChunk(tile.dest.y);
+      const int maxX = toChunk(tile.dest.x + tile.dest.w - 1);
+      const int maxY = toChunk(tile.dest.y + tile.dest.h - 1);
+      for (int cy = minY; cy <= maxY; ++cy) {
+        for (int cx = minX; cx <= maxX; ++cx) {
+          Chunk& chunk = chunks[key(cx, cy)];
+          const SDL_Rect cell{cx * chunkSize, cy * chunkSize, chunkSize, chunkSize};
+          SDL_Rect covered{0, 0, 0, 0};
+          SDL_IntersectRect(&tile.dest, &cell, &covered);
+          if (chunk.tiles.empty()) {
+            chunk.bounds = covered;
+          } else {
+            SDL_UnionRect(&chunk.bounds, &covered, &chunk.bounds);
+          }
+          chunk.tiles.push_back(i);
+          chunk.bakeFailed = false;
+          release(chunk);
+        }
+      }
+    }
+  }
+
+  void TileChunkCache::clear() {
+    releaseAll();
+    chunks.clear();
+    frame = 0;
+  }
+
+  void TileChunkCache::render(const std::vector<BuiltTile>& tiles, const SDL_FRect* camRect, float camX, float camY, float zoom) {
+    if (!renderer || chunks.empty()) return;
+    ++frame;
+
+    if (targetsReset.exchange(false)) releaseAll();
+
+    if (!camRect) {
+      for (auto& [id, chunk] : chunks) {
+        drawChunk(chunk, tiles, nullptr, camX, camY, zoom);
+      }
+    } else {
+      const int minX = toChunk(static_cast<int>(std::floor(camRect->x)));
+      const int minY = toChunk(static_cast<int>(std::floor(camRect->y)));
+      const int maxX = toChunk(static_cast<int>(std::ceil(camRect->x + camRect->w)));
+      const int maxY = toChunk(static_cast<int>(std::ceil(camRect->y + camRect->h)));
+      for (int cy = minY; cy <= maxY; ++cy) {
+        for (int cx = minX; cx <= maxX; ++cx) {
+          auto it = chunks.find(key(cx, cy));
+          if (it != chunks.end()) drawChunk(it->second, tiles, camRect, camX, camY, zoom);
+        }
+      }
+    }
+
+    if (bakedCount > Constants::TILE_CHUNK_MAX_BAKED) evict();
+  }
+
+  uint64_t TileChunkCache::key(int cx, int cy) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << Constants::BIT_32) | static_cast<uint32_t>(cy);
+  }
+
+  int TileChunkCache::handleRenderEvent(void* userData, SDL_Event* event) {
+    if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) {
+      static_cast<TileChunkCache*>(userData)->targetsReset.store(true);
+    }
+    return 0;
+  }
+
+  int TileChunkCache::toChunk(int coordinate) const {
+    return coordinate >= 0 ? coordinate / chunkSize : -((-coordinate + chunkSize - 1) / chunkSize);
+  }
+
+  void TileChunkCache::bake(Chunk& chunk, const std::vector<BuiltTile>& tiles) {
+    if (!chunk.texture) {
+      chunk.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, chunk.bounds.w, chunk.bounds.h);
+      if (!chunk.texture) {
+        chunk.bakeFailed = true;
+        return;
+      }
+      if (SDL_SetTextureBlendMode(chunk.texture, premultipliedBlendMode()) != 0) {
+        SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+      }
+      ++bakedCount;
+    }
+
+    Uint8 r = 0, g = 0, b = 0, a = 0;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, chunk.texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for (size_t index : chunk.tiles) {
+      if (index >= tiles.size()) continue;
+      const BuiltTile& tile = tiles[index];
+      if (!tile.texture) continue;
+      const SDL_Rect dest{tile.dest.x - chunk.bounds.x, tile.dest.y - chunk.bounds.y, tile.dest.w, tile.dest.h};
+      SDL_RenderCopy(renderer, tile.texture, &tile.src, &dest);
+    }
+
+    SDL_SetRenderTarget(renderer, previous);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    chunk.dirty = false;
+  }
+
+  void TileChunkCache::drawChunk(Chunk& chunk, const std::vector<BuiltTile>& tiles, const SDL_FRect* camRect, float camX, float camY, float zoom) {
+    if (camRect) {
+      const SDL_FRect worldRect{
+        static_cast<float>(chunk.bounds.x), static_cast<float>(chunk.bounds.y),
+        static_cast<float>(chunk.bounds.w), static_cast<float>(chunk.bounds.h)};
+      if (!SDL_HasIntersectionF(&worldRect, camRect)) return;
+    }
+
+    if (chunk.dirty && !chunk.bakeFailed) bake(chunk, tiles);
+    chunk.lastUsed = frame;
+
+    auto project = [&](const SDL_Rect& rect) {
+      SDL_FRect dest{static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w), static_cast<float>(rect.h)};
+      if (camRect) {
+        dest.x = (dest.x - camX) * zoom;
+        dest.y = (dest.y - camY) * zoom;
+        dest.w *= zoom;
+        dest.h *= zoom;
+      }
+      return dest;
+    };
+
+    if (chunk.texture && !chunk.dirty) {
+      const SDL_FRect dest = project(chunk.bounds);
+      SDL_RenderCopyF(renderer, chunk.texture, nullptr, &dest);
+      return;
+    }
+
+    for (size_t index : chunk.tiles) {
+      if (index >= tiles.size()) continue;
+      const BuiltTile& tile = tiles[index];
+      if (!tile.texture) continue;
+      SDL_Rect clipped{0, 0, 0, 0};
+      if (!SDL_IntersectRect(&tile.dest, &chunk.bounds, &clipped)) continue;
+      SDL_Rect src = tile.src;
+      if (tile.dest.w > 0 && tile.dest.h > 0) {
+        src.x += (clipped.x - tile.dest.x) * tile.src.w / tile.dest.w;
+        src.y += (clipped.y - tile.dest.y) * tile.src.h / tile.dest.h;
+        src.w = clipped.w * tile.src.w / tile.dest.w;
+        src.h = clipped.h * tile.src.h / tile.dest.h;
+      }
+      const SDL_FRect dest = project(clipped);
+      SDL_RenderCopyF(renderer, tile.texture, &src, &dest);
+    }
+  }
+
+  void TileChunkCache::release(Chunk& chunk) {
+    if (chunk.texture) {
+      SDL_DestroyTexture(chunk.texture);
+      chunk.texture = nullptr;
+      --bakedCount;
+    }
+    chunk.dirty = true;
+  }
+
+  void TileChunkCache::releaseAll() {
+    for (auto& [id, chunk] : chunks) {
+      release(chunk);
+      chunk.bakeFailed = false;
+    }
+  }
+
+  void TileChunkCache::evict() {
+    std::vector<Chunk*> baked;
+    baked.reserve(bakedCount);
+    for (auto& [id, chunk] : chunks) {
+      if (chunk.texture && chunk.lastUsed != frame) baked.push_back(&chunk);
+    }
+    std::sort(baked.begin(), baked.end(), [](const Chunk* a, const Chunk* b) { return a->lastUsed < b->lastUsed; });
+    for (Chunk* chunk : baked) {
+      if (bakedCount <= Constants::TILE_CHUNK_MAX_BAKED) break;
+      release(*chunk);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef TILE_CHUNK_CACHE_H
+#define TILE_CHUNK_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+
+#include "TileHandler.h"
+
+namespace Project::Handlers {
+  class TileChunkCache {
+  public:
+    explicit TileChunkCache(SDL_Renderer* renderer);
+    ~TileChunkCache();
+
+    TileChunkCache(const TileChunkCache&) = delete;
+    TileChunkCache& operator=(const TileChunkCache&) = delete;
+
+    void add(const std::vector<BuiltTile>& tiles, size_t firstIndex);
+    void clear();
+
+    void render(const std::vector<BuiltTile>& tiles, const SDL_FRect* camRect, float camX, float camY, float zoom);
+
+    size_t getBakedCount() const { return bakedCount; }
+
+  private:
+    struct Chunk {
+      SDL_Rect bounds{0, 0, 0, 0};
+      SDL_Texture* texture = nullptr;
+      std::vector<size_t> tiles;
+      uint64_t lastUsed = 0;
+      bool dirty = true;
+      bool bakeFailed = false;
+    };
+
+    SDL_Renderer* renderer;
+    std::unordered_map<uint64_t, Chunk> chunks;
+    uint64_t frame = 0;
+    size_t bakedCount = 0;
+    int chunkSize;
+    std::atomic<bool> targetsReset{false};
+
+    static uint64_t key(int cx, int cy);
+    static int handleRenderEvent(void* userData, SDL_Event* event);
+    int toChunk(int coordinate) const;
+
+    void bake(Chunk& chunk, const std::vector<BuiltTile>& tiles);
+    void drawChunk(Chunk& chunk, const std::vector<BuiltTile>& tiles, const SDL_FRect* camRect, float camX, float camY, float zoom);
+    void release(Chunk& chunk);
+    void releaseAll();
+    void evict();
+  };
+}
+
+#endif
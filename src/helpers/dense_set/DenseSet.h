@@ -0,0 +1,62 @@
+#ifndef DENSE_SET_H
+#define DENSE_SET_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace Project::Helpers {
+  template <typename T>
+  class DenseSet {
+  public:
+    using Iterator = typename std::vector<T*>::const_iterator;
+
+    bool insert(T* item) {
+      if (!item) return false;
+      auto [it, inserted] = indices.emplace(item, items.size());
+      if (!inserted) return false;
+      items.push_back(item);
+      return true;
+    }
+
+    bool erase(T* item) {
+      auto it = indices.find(item);
+      if (it == indices.end()) return false;
+
+      size_t index = it->second;
+      T* last = items.back();
+      items[index] = last;
+      items.pop_back();
+      indices.erase(it);
+      if (last != item) indices[last] = index;
+      return true;
+    }
+
+    bool contains(T* item) const { return indices.find(item) != indices.end(); }
+
+    void reserve(size_t capacity) {
+      items.reserve(capacity);
+      indices.reserve(capacity);
+    }
+
+    void clear() {
+      items.clear();
+      indices.clear();
+    }
+
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+
+    T* operator[](size_t index) const { return items[index]; }
+    const std::vector<T*>& values() const { return items; }
+
+    Iterator begin() const { return items.begin(); }
+    Iterator end() const { return items.end(); }
+
+  private:
+    std::vector<T*> items;
+    std::unordered_map<T*, size_t> indices;
+  };
+}
+
+#endif
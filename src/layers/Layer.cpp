@@ -50,10 +50,8 @@ namespace Project::Layers {
           SDL_SetRenderDrawColor(renderer, Constants::COLOR_BLACK.r, Constants::COLOR_BLACK.g, Constants::COLOR_BLACK.b, static_cast<Uint8>(darkness * Constants::FLOAT_255));
           SDL_RenderClear(renderer);
 
-          auto& comps = entitiesManager->getComponentArray(Project::Components::ComponentType::VISION);
-          for (auto* base : comps) {
-            auto* vision = dynamic_cast<Project::Components::VisionComponent*>(base);
-            if (vision) vision->renderMask(renderer);
+          for (auto [owner, vision] : entitiesManager->query<Project::Components::VisionComponent>()) {
+            vision->renderMask(renderer);
           }
 
           SDL_SetRenderTarget(renderer, nullptr);
@@ -64,6 +62,15 @@ namespace Project::Layers {
     }
   }
 
+  Project::Utilities::BroadPhaseType Layer::getBroadPhaseType() const {
+    if (!entitiesManager) return Project::Systems::PhysicsSystem::getDefaultBroadPhaseType();
+    return entitiesManager->getPhysicsSystem().getBroadPhaseType();
+  }
+
+  void Layer::setBroadPhaseType(Project::Utilities::BroadPhaseType type) {
+    if (entitiesManager) entitiesManager->getPhysicsSystem().setBroadPhaseType(type);
+  }
+
   void Layer::setDarkness(float value) {
     darkness = std::clamp(value, Constants::ANGLE_0_DEG, Constants::DEFAULT_WHOLE);
   }
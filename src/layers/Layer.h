@@ -39,6 +39,9 @@ namespace Project::Layers {
     std::shared_ptr<Project::Entities::EntitiesManager> getEntitiesManager() const { return entitiesManager; }
     void setEntitiesManager(std::shared_ptr<Project::Entities::EntitiesManager> mgr) { entitiesManager = std::move(mgr); }
 
+    Project::Utilities::BroadPhaseType getBroadPhaseType() const;
+    void setBroadPhaseType(Project::Utilities::BroadPhaseType type);
+
     void setDarkness(float value);
     float getDarkness() const { return darkness; }
 
@@ -158,10 +158,8 @@ namespace Project::Layers {
     for (auto& layer : layers) {
       auto mgr = layer.getEntitiesManager();
       if (!mgr) continue;
-      auto& comps = mgr->getComponentArray(Project::Components::ComponentType::VISION);
-      for (auto* base : comps) {
-        auto* vision = dynamic_cast<Project::Components::VisionComponent*>(base);
-        if (vision) vision->renderMask(renderer);
+      for (auto [owner, vision] : mgr->query<Project::Components::VisionComponent>()) {
+        vision->renderMask(renderer);
       }
     }
   }
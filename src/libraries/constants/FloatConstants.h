@@ -34,6 +34,11 @@ namespace Project::Libraries::Constants {
   constexpr float RAYCAST_MAX_DISTANCE = 1e9f;
   constexpr float RAYCAST_EPSILON = 1e-6f;
 
+  constexpr float PARALLEL_UPDATE_TARGET_CHUNK_NS = 50000.0f;
+  constexpr float PARALLEL_UPDATE_INITIAL_COST_NS = 5000.0f;
+  constexpr float PARALLEL_UPDATE_COST_SMOOTHING = 0.1f;
+  constexpr float BROAD_PHASE_RECALIBRATE_RATIO = 2.0f;
+
   constexpr float DEFAULT_FRECT_X = -1e9f;
   constexpr float DEFAULT_FRECT_Y = -1e9f;
   constexpr float DEFAULT_FRECT_W = 2e9;
@@ -37,6 +37,7 @@ namespace Project::Libraries::Constants {
 
   constexpr const char* FULLSCREEN = "Fullscreen";
   constexpr const char* WINDOWED = "Windowed";
+  constexpr const char* HEADLESS = "Headless";
 
   constexpr const char* CIRCLE = "circle";
   constexpr const char* CONE = "cone";
@@ -2,6 +2,7 @@
 #define NUMERIC_CONSTANTS_H
 
 #include <cstddef>
+#include <cstdint>
 
 namespace Project::Libraries::Constants {
   constexpr int ATLAS_WIDTH = 2048;
@@ -36,6 +37,7 @@ namespace Project::Libraries::Constants {
   constexpr int DEFAULT_TEXT_HEIGHT_OFFSET = 5;
   constexpr int DEFAULT_RENDER_CELL_SIZE = 512;
   constexpr int DEFAULT_MAX_DIM = 2048;
+  constexpr int TILE_CHUNK_SIZE = 512;
   
   constexpr int INT_ONE = 1;
   constexpr int INT_TEN = 10;
@@ -60,6 +62,36 @@ namespace Project::Libraries::Constants {
   constexpr size_t MAX_PATH_SIZE = 4096;
   constexpr size_t MAX_DATA_SIZE = 10 * 1024 * 1024;
 
+  constexpr std::uint32_t CACHE_STORE_MAGIC = 0x42584450;
+  constexpr std::uint32_t CACHE_INDEX_MAGIC = 0x49584450;
+  constexpr std::uint32_t CACHE_STORE_VERSION = 1;
+  constexpr std::uint64_t CACHE_COMPACT_MIN_BYTES = 1024 * 1024;
+
+  constexpr size_t ARCHETYPE_CHUNK_CAPACITY = 128;
+
+  constexpr size_t BVH_SAH_BIN_COUNT = 16;
+  constexpr size_t BVH_REBUILD_MIN_INSERTS = 64;
+  constexpr size_t BROAD_PHASE_CALIBRATION_ROUNDS = 4;
+  constexpr size_t BROAD_PHASE_CALIBRATION_WARMUP = 2;
+  constexpr size_t BROAD_PHASE_MIN_RECALIBRATE_COUNT = 64;
+  constexpr size_t SPATIAL_HASH_INITIAL_SLOTS = 1024;
+  constexpr size_t NARROW_PHASE_CHUNK_SIZE = 64;
+  constexpr size_t SWEEP_AND_PRUNE_BATCH_THRESHOLD = 64;
+  constexpr size_t BVH_QUERY_STACK_SIZE = 64;
+
+  constexpr size_t SPRITE_BATCH_INITIAL_QUADS = 1024;
+  constexpr size_t TILE_CHUNK_MAX_BAKED = 64;
+
+  constexpr size_t PROFILER_RING_CAPACITY = 16384;
+  constexpr size_t PROFILER_SCOPE_SLOTS = 256;
+
+  constexpr size_t TASK_STORAGE_SIZE = 48;
+  constexpr size_t TASK_DEQUE_CAPACITY = 1024;
+  constexpr size_t TASK_QUEUE_CAPACITY = 4096;
+  constexpr size_t THREAD_SPIN_COUNT = 64;
+  constexpr size_t PARALLEL_UPDATE_MIN_CHUNK = 8;
+  constexpr size_t PARALLEL_UPDATE_MAX_CHUNK = 512;
+
   constexpr size_t DEFAULT_ENTITIES_PER_CHUNK = 32;
   constexpr size_t DEFAULT_INITIAL_CAPACITY = 1000;
   constexpr size_t MAX_SEEDED_ENTITY = 1000;
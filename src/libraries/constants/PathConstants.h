@@ -17,6 +17,7 @@ namespace Project::Libraries::Constants {
   constexpr const char* DEFAULT_SCRIPT_PATH = "scripts/";
   constexpr const char* DEFAULT_STATE_SCRIPT_FOLDER = "scripts/states/";
   constexpr const char* DEFAULT_STYLE_PATH = "resources/style";
+  constexpr const char* DEFAULT_TRACE_FILE_PATH = "resources/logs/trace.json";
   
   constexpr const char* HAND_CURSOR_PATH = "resources/system/cursor_hand.png";
   constexpr const char* TEXT_CURSOR_PATH = "resources/system/cursor_text.png";
@@ -27,6 +28,8 @@ namespace Project::Libraries::Constants {
   constexpr const char* SCRIPT_FUNCTION_CACHE_FILE = "cache/script_function_cache.cache";
   constexpr const char* SHADER_CACHE_FILE = "cache/shader.cache";
   constexpr const char* STYLE_CACHE_FILE = "cache/style.cache";
+  constexpr const char* CACHE_INDEX_EXTENSION = ".idx";
+  constexpr const char* CACHE_TEMP_EXTENSION = ".tmp";
 }
 
 #endif
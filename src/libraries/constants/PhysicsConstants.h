@@ -33,6 +33,9 @@ namespace Project::Libraries::Constants {
   constexpr float MID_TICK_MULTIPLIER = Constants::DEFAULT_DOUBLE;
   constexpr float FAR_TICK_MULTIPLIER = Constants::DEFAULT_DOUBLE * Constants::DEFAULT_DOUBLE;
 
+  constexpr float BVH_FAT_MARGIN = 4.0f;
+  constexpr float BVH_DISPLACEMENT_MULTIPLIER = 2.0f;
+
   constexpr SDL_FPoint DEFAULT_GRAVITY_DIRECTION{0.0f, 1.0f};
 }
 
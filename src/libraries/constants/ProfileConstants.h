@@ -12,6 +12,11 @@ namespace Project::Libraries::Constants {
   constexpr const char* RENDER_SCOPE = "render";
   constexpr const char* POST_PROCESS_SCOPE = "postprocess";
   constexpr const char* PARTICLE_SCOPE = "particles";
+
+  constexpr const char* FRAME_MARKER = "frame";
+  constexpr const char* TRACE_CPU_CATEGORY = "cpu";
+  constexpr const char* TRACE_GPU_CATEGORY = "gpu";
+  constexpr const char* TRACE_THREAD_PREFIX = "thread ";
 }
 
 #endif
@@ -10,6 +10,10 @@ namespace Project::Libraries::Constants {
   constexpr const char* LUA_ITEM_SUFFIX = ".item.lua";
   constexpr const char* LUA_ASSET_SUFFIX = ".asset.lua";
 
+  constexpr const char* LUA_ACTIVE_ENVIRONMENT = "doeville.activeEnvironment";
+  constexpr const char* LUA_ENVIRONMENT_META = "doeville.environmentMeta";
+  constexpr const char* LUA_SHARED_BINDINGS = "doeville.sharedBindings";
+
   constexpr const char* SCRIPT_LUA_SUFFIX = ".lua";
   constexpr const char* SCRIPT_PYTHON_SUFFIX = ".py";
   constexpr const char* SCRIPT_JAVASCRIPT_SUFFIX = ".js";
@@ -42,6 +42,24 @@ namespace Project::Libraries::Keys {
   constexpr const char* POOLS_SECTION = "Pools";
   constexpr const char* POOL_ENTITY_MAX = "entity_max";
   constexpr const char* POOL_COMPONENT_MAX = "component_max";
+  constexpr const char* SCRIPTING_SECTION = "Scripting";
+  constexpr const char* SCRIPTING_SHARED_VM = "shared_vm";
+  constexpr const char* SCRIPTING_PARALLEL_UPDATE = "parallel_update";
+  constexpr const char* PHYSICS_SECTION = "Physics";
+  constexpr const char* PHYSICS_BROAD_PHASE = "broad_phase";
+  constexpr const char* PROFILER_SECTION = "Profiler";
+  constexpr const char* PROFILER_ENABLED = "enabled";
+  constexpr const char* PROFILER_TRACE_PATH = "trace_path";
+  constexpr const char* HEADLESS_SECTION = "Headless";
+  constexpr const char* HEADLESS_ENABLED = "enabled";
+  constexpr const char* HEADLESS_TICK_RATE = "tick_rate";
+  constexpr const char* HEADLESS_UNLOCKED = "unlocked";
+  constexpr const char* HEADLESS_MAX_TICKS = "max_ticks";
+
+  //Command line flags
+  constexpr const char* ARG_HEADLESS = "--headless";
+  constexpr const char* ARG_UNLOCKED = "--unlocked";
+  constexpr const char* ARG_TICKS = "--ticks";
 }
 
 #endif
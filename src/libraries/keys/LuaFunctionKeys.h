@@ -48,6 +48,8 @@ namespace Project::Libraries::Keys {
   constexpr const char* LUA_DESTROY_ENTITY = "destroyEntity";
   constexpr const char* LUA_DESTROY_ENTITIES = "destroyEntities";
   constexpr const char* LUA_DESTROY_SELF = "destroySelf";
+  constexpr const char* LUA_ADD_COMPONENT = "addComponent";
+  constexpr const char* LUA_REMOVE_COMPONENT = "removeComponent";
   constexpr const char* LUA_IGNORE_COLLISIONS_WITH = "ignoreCollisionsWith";
   constexpr const char* LUA_IS_ACTION_PRESSED = "isActionPressed";
   constexpr const char* LUA_START_ENTITY_SEEDER = "startEntitySeeder";
@@ -55,6 +57,9 @@ namespace Project::Libraries::Keys {
   constexpr const char* LUA_RESET_STATE = "resetState";
   constexpr const char* LUA_EXIT_GAME = "exitGame";
   constexpr const char* LUA_ON_TRIGGER = "onTrigger";
+  constexpr const char* LUA_ON_COLLISION_ENTER = "onCollisionEnter";
+  constexpr const char* LUA_ON_COLLISION_STAY = "onCollisionStay";
+  constexpr const char* LUA_ON_COLLISION_EXIT = "onCollisionExit";
   constexpr const char* LUA_FUNC_PRINT = "print";
   constexpr const char* LUA_FUNC_SPAWN = "spawn";
   constexpr const char* LUA_FUNC_FAST_DISTANCE = "fastDistance";
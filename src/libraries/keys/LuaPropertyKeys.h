@@ -18,6 +18,7 @@ namespace Project::Libraries::Keys {
   constexpr const char* BOXES = "boxes";
   constexpr const char* BORDER_RADIUS = "border_radius";
   constexpr const char* BRAKE_POWER  = "brake_power"; 
+  constexpr const char* BROAD_PHASE = "broad_phase";
   constexpr const char* CALLBACKS = "callbacks";
   constexpr const char* CATEGORY = "category";
   constexpr const char* CANCEL_CALLBACK = "cancel_callback";
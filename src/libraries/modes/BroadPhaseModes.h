@@ -0,0 +1,18 @@
+#ifndef BROAD_PHASE_MODES_H
+#define BROAD_PHASE_MODES_H
+
+#include <cstddef>
+
+namespace Project::Libraries::Modes {
+  namespace BroadPhases {
+    constexpr size_t BROAD_PHASE_NAME_ALIAS_COUNT = 5;
+
+    constexpr const char* AUTO = "AUTO";
+    constexpr const char* BVH = "BVH";
+    constexpr const char* GRID = "GRID";
+    constexpr const char* QUAD_TREE = "QUAD_TREE";
+    constexpr const char* SWEEP_AND_PRUNE = "SWEEP_AND_PRUNE";
+  }
+}
+
+#endif
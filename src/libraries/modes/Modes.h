@@ -1,6 +1,7 @@
 #ifndef MODES_H
 #define MODES_H
 
+#include "BroadPhaseModes.h"
 #include "DimensionModes.h"
 #include "MovementModes.h"
 
@@ -10,6 +10,7 @@ int main(int argc, char* argv[]) {
   Project::Core::GameEngine engine;
   
   try {
+    engine.parseArguments(argc, argv);
     engine.init();
     engine.run();
   } catch (const Project::Utilities::EngineException& e) {
@@ -27,6 +27,9 @@ namespace Project::Platform {
     virtual void clearExitRequest() = 0;
 
     virtual void setRendererAPI(std::unique_ptr<RendererAPI> api) = 0;
+
+    virtual void setHeadless(bool headless) = 0;
+    virtual bool isHeadless() const = 0;
   };
 }
 
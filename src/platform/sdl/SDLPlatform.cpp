@@ -8,9 +8,9 @@ namespace Project::Platform {
   namespace Constants = Project::Libraries::Constants;
   SDLPlatform::SDLPlatform(LogsManager& logsManager)
     : logsManager(logsManager), rendererAPI(nullptr), 
-      window(nullptr), renderer(nullptr), glContext(nullptr), 
+      window(nullptr), renderer(nullptr), glContext(nullptr), headlessSurface(nullptr),
       exitRequested(false), initialized(false),
-      openGLMode(false), vsyncEnabled(false) {}
+      openGLMode(false), vsyncEnabled(false), headlessMode(false) {}
 
   SDLPlatform::~SDLPlatform() {
     cleanup();
@@ -25,6 +25,10 @@ namespace Project::Platform {
   }
 
   bool SDLPlatform::init(const std::string& title, int width, int height, bool fullscreen, bool vsync, bool opengl) {
+    if (headlessMode) {
+      return initHeadless(width, height);
+    }
+
     if (logsManager.checkAndLogError(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) < 0, "SDL could not initialize! SDL_Error: " + std::string(SDL_GetError()))) {
       return false;
     }
@@ -75,7 +79,28 @@ namespace Project::Platform {
     return true;
   }
 
+  bool SDLPlatform::initHeadless(int width, int height) {
+    if (logsManager.checkAndLogError(SDL_Init(SDL_INIT_EVENTS | SDL_INIT_TIMER) < 0, "SDL could not initialize! SDL_Error: " + std::string(SDL_GetError()))) {
+      return false;
+    }
+
+    headlessSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, Constants::BIT_32, SDL_PIXELFORMAT_RGBA8888);
+    if (logsManager.checkAndLogError(!headlessSurface, "Headless surface could not be created! SDL_Error: " + std::string(SDL_GetError()))) {
+      return false;
+    }
+
+    renderer = SDL_CreateSoftwareRenderer(headlessSurface);
+    if (logsManager.checkAndLogError(!renderer, "Headless renderer could not be created! SDL_Error: " + std::string(SDL_GetError()))) {
+      return false;
+    }
+
+    logsManager.logMessage("Platform initialized. Mode: " + std::string(Constants::HEADLESS) + ", Size: " + std::to_string(width) + "x" + std::to_string(height));
+    initialized = true;
+    return true;
+  }
+
   void SDLPlatform::present() {
+    if (headlessMode) return;
     if (rendererAPI) {
       rendererAPI->present();
       return;
@@ -98,11 +123,17 @@ namespace Project::Platform {
       window = nullptr;
     }
 
+    if (headlessSurface) {
+      SDL_FreeSurface(headlessSurface);
+      headlessSurface = nullptr;
+    }
+
     SDL_Quit();
     initialized = false;
   }
 
   void SDLPlatform::clear() {
+    if (headlessMode) return;
     if (rendererAPI) {
       rendererAPI->clear();
       return;
@@ -29,6 +29,9 @@ namespace Project::Platform {
 
     void setRendererAPI(std::unique_ptr<RendererAPI> api);
 
+    void setHeadless(bool headless) override { headlessMode = headless; }
+    bool isHeadless() const override { return headlessMode; }
+
   private:
     Project::Utilities::LogsManager& logsManager;
     std::unique_ptr<RendererAPI> rendererAPI;
@@ -36,12 +39,16 @@ namespace Project::Platform {
     SDL_Window* window;
     SDL_Renderer* renderer;
     SDL_GLContext glContext;
+    SDL_Surface* headlessSurface;
 
     bool exitRequested;
     bool initialized;
 
     bool openGLMode;
     bool vsyncEnabled;
+    bool headlessMode;
+
+    bool initHeadless(int width, int height);
   };
 }
 
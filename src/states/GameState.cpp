@@ -30,7 +30,7 @@ namespace Project::States {
   Project::Utilities::BinaryFileCache GameState::persistentFunctionCache(Constants::SCRIPT_FUNCTION_CACHE_FILE);
 
   GameState::GameState(SDL_Renderer* renderer, LogsManager& logsManager, ResourcesHandler& resourcesHandler)
-  : LuaScriptable(logsManager), resourcesHandler(resourcesHandler), renderer(renderer) {}
+  : LuaScriptable(logsManager), resourcesHandler(resourcesHandler), renderer(renderer), tileChunks(renderer) {}
 
   GameState::~GameState() {
     clearBackground();
@@ -140,37 +140,11 @@ namespace Project::States {
     }
     
     auto* camHandler = Project::Components::GraphicsComponent::getCameraHandler();
-    float zoom = Constants::DEFAULT_CAMERA_ZOOM;
-    SDL_FRect viewport{0.0f, 0.0f, 0.0f, 0.0f};
-    SDL_FRect camRect{0.0f, 0.0f, 0.0f, 0.0f};
-    float camX = 0.0f;
-    float camY = 0.0f;
-    bool useCull = false;
     if (camHandler) {
-      zoom = camHandler->getZoom();
-      camX = camHandler->getX();
-      camY = camHandler->getY();
-      viewport = SDL_FRect{0.0f, 0.0f, static_cast<float>(camHandler->getViewportWidth()), static_cast<float>(camHandler->getViewportHeight())};
-      camRect = camHandler->getRect();
-      useCull = true;
-    }
-
-    for (const auto& tile : mapTiles) {
-      if (!tile.texture) continue;
-      SDL_FRect worldRect{static_cast<float>(tile.dest.x), static_cast<float>(tile.dest.y), static_cast<float>(tile.dest.w), static_cast<float>(tile.dest.h)};
-      if (useCull && !SDL_HasIntersectionF(&worldRect, &camRect)) {
-        continue;
-      }
-
-      SDL_FRect dest = worldRect;
-      if (useCull) {
-        dest.x = (worldRect.x - camX) * zoom;
-        dest.y = (worldRect.y - camY) * zoom;
-        dest.w = worldRect.w * zoom;
-        dest.h = worldRect.h * zoom;
-        if (!SDL_HasIntersectionF(&dest, &viewport)) continue;
-      }
-      SDL_RenderCopyF(renderer, tile.texture, &tile.src, &dest);
+      const SDL_FRect camRect = camHandler->getRect();
+      tileChunks.render(mapTiles, &camRect, camHandler->getX(), camHandler->getY(), camHandler->getZoom());
+    } else {
+      tileChunks.render(mapTiles, nullptr, 0.0f, 0.0f, Constants::DEFAULT_CAMERA_ZOOM);
     }
 
     if (layersManager) {
@@ -214,10 +188,8 @@ namespace Project::States {
         if (layersManager) {
           layersManager->renderVisionMask(renderer);
         } else if (entitiesManager) {
-          auto& comps = entitiesManager->getComponentArray(Project::Components::ComponentType::VISION);
-          for (auto* base : comps) {
-            auto* vision = dynamic_cast<Project::Components::VisionComponent*>(base);
-            if (vision) vision->renderMask(renderer);
+          for (auto [owner, vision] : entitiesManager->query<Project::Components::VisionComponent>()) {
+            vision->renderMask(renderer);
           }
         }
 
@@ -259,6 +231,7 @@ namespace Project::States {
     }
 
     clearBackground();
+    tileChunks.clear();
     mapTiles.clear();
 
     luaStateWrapper.reset();
@@ -660,7 +633,9 @@ namespace Project::States {
       }
       cropped.push_back(tile);
     }
+    const size_t firstIndex = mapTiles.size();
     mapTiles.insert(mapTiles.end(), cropped.begin(), cropped.end());
+    tileChunks.add(mapTiles, firstIndex);
   }
 
   void GameState::ensureMapSize() {
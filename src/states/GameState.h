@@ -18,6 +18,7 @@
 #include "entities/EntitiesManager.h"
 #include "entities/EntitySeeder.h"
 #include "handlers/resources/ResourcesHandler.h"
+#include "handlers/tile/TileChunkCache.h"
 #include "handlers/tile/TileHandler.h"
 #include "interfaces/update_interface/Updatable.h"
 #include "interfaces/reset_interface/Resetable.h"
@@ -199,6 +200,7 @@ namespace Project::States {
     std::unordered_map<std::string, std::unique_ptr<Project::Entities::EntitySeeder>> entitySeeders;
     std::unordered_map<std::string, std::string> entityScriptOverrides;
     std::vector<Project::Handlers::BuiltTile> mapTiles;
+    Project::Handlers::TileChunkCache tileChunks;
 
     void ensureMapSize();
     void updateDayNightCycle(float deltaTime);
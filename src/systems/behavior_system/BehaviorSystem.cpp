@@ -1,8 +1,6 @@
 
 #include "BehaviorSystem.h"
 
-#include <algorithm>
-
 #include "components/behavior_component/BehaviorComponent.h"
 #include "libraries/constants/ProfileConstants.h"
 #include "utilities/profiler/Profiler.h"
@@ -20,11 +18,11 @@ namespace Project::Systems {
   }
 
   void BehaviorSystem::add(BehaviorComponent* component) {
-    if (component) components.push_back(component);
+    components.insert(component);
   }
 
   void BehaviorSystem::remove(BehaviorComponent* component) {
-    components.erase(std::remove(components.begin(), components.end(), component), components.end());
+    components.erase(component);
   }
 
   void BehaviorSystem::clear() {
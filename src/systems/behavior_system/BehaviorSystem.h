@@ -1,8 +1,7 @@
 #ifndef BEHAVIOR_SYSTEM_H
 #define BEHAVIOR_SYSTEM_H
 
-#include <vector>
-
+#include "helpers/dense_set/DenseSet.h"
 #include "interfaces/update_interface/Updatable.h"
 
 namespace Project { namespace Components { class BehaviorComponent; } }
@@ -17,7 +16,7 @@ namespace Project::Systems {
     void clear();
 
   private:
-    std::vector<Project::Components::BehaviorComponent*> components;
+    Project::Helpers::DenseSet<Project::Components::BehaviorComponent> components;
   };
 }
 
@@ -1,6 +1,7 @@
 #include "MotionSystem.h"
-#include <algorithm>
 #include "components/motion_component/MotionComponent.h"
+#include "entities/ComponentQuery.h"
+#include "entities/Entity.h"
 #include "libraries/constants/NumericConstants.h"
 #include "libraries/constants/ProfileConstants.h"
 #include "utilities/profiler/Profiler.h"
@@ -9,27 +10,24 @@ namespace Project::Systems {
   using Project::Components::MotionComponent;
 
   MotionSystem::MotionSystem() {
-    components.reserve(Project::Libraries::Constants::INT_HUNDRED);
-  }
-
-  void Project::Systems::MotionSystem::add(MotionComponent* component) {
-    if (component) components.push_back(component);
-  }
-
-  void Project::Systems::MotionSystem::remove(MotionComponent* component) {
-    components.erase(std::remove(components.begin(), components.end(), component), components.end());
+    movedEntities.reserve(Project::Libraries::Constants::INT_HUNDRED);
   }
 
   void Project::Systems::MotionSystem::update(float deltaTime) {
     PROFILE_SCOPE(Project::Libraries::Constants::MOTION_PROFILE);
-    for (auto* comp : components) {
-      if (comp && comp->isActive()) {
+    movedEntities.clear();
+    if (!storage) return;
+    for (auto [owner, comp] : Project::Entities::ComponentQuery<MotionComponent>(*storage)) {
+      if (comp->isActive()) {
         comp->update(deltaTime);
+        if (owner->consumeBoundsDirty()) {
+          movedEntities.push_back(owner->getHandle());
+        }
       }
     }
   }
 
   void Project::Systems::MotionSystem::clear() {
-    components.clear();
+    movedEntities.clear();
   }
 }
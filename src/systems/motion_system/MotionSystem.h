@@ -2,23 +2,27 @@
 #define MOTION_SYSTEM_H
 
 #include <vector>
+
+#include "entities/EntityHandle.h"
 #include "interfaces/update_interface/Updatable.h"
 
-namespace Project { namespace Components { class MotionComponent; } }
+namespace Project { namespace Entities { class ArchetypeStorage; } }
 
 namespace Project::Systems {
   class MotionSystem : public Project::Interfaces::Updatable {
   public:
     MotionSystem();
-    
-    void add(Project::Components::MotionComponent* component);
-    void remove(Project::Components::MotionComponent* component);
+
+    void setStorage(const Project::Entities::ArchetypeStorage* archetypeStorage) { storage = archetypeStorage; }
 
     void update(float deltaTime) override;
     void clear();
+
+    const std::vector<Project::Entities::EntityHandle>& getMovedEntities() const { return movedEntities; }
       
     private:
-    std::vector<Project::Components::MotionComponent*> components;
+    const Project::Entities::ArchetypeStorage* storage = nullptr;
+    std::vector<Project::Entities::EntityHandle> movedEntities;
   };
 }
 
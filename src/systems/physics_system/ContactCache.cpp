@@ -0,0 +1,52 @@
+#include "ContactCache.h"
+
+namespace Project::Systems {
+  using Project::Entities::EntityHandle;
+
+  void ContactCache::beginFrame() {
+    ++frame;
+    events.clear();
+  }
+
+  void ContactCache::add(EntityHandle a, EntityHandle b) {
+    if (!a.isValid() || !b.isValid() || a == b) return;
+
+    uint64_t first = a.toKey();
+    uint64_t second = b.toKey();
+    if (second < first) std::swap(first, second);
+    entries[PairKey{first, second}].frame = frame;
+  }
+
+  void ContactCache::endFrame() {
+    touching.clear();
+    for (auto it = entries.begin(); it != entries.end();) {
+      const EntityHandle first = EntityHandle::fromKey(it->first.first);
+      const EntityHandle second = EntityHandle::fromKey(it->first.second);
+      Entry& entry = it->second;
+
+      if (entry.frame != frame) {
+        events.push_back({ContactEventType::EXIT, first, second});
+        it = entries.erase(it);
+        continue;
+      }
+
+      events.push_back({entry.touching ? ContactEventType::STAY : ContactEventType::ENTER, first, second});
+      entry.touching = true;
+      touching.emplace_back(it->first.first, second);
+      touching.emplace_back(it->first.second, first);
+      ++it;
+    }
+
+    std::sort(touching.begin(), touching.end(),
+      [](const std::pair<uint64_t, EntityHandle>& a, const std::pair<uint64_t, EntityHandle>& b) {
+        return a.first < b.first;
+      });
+  }
+
+  void ContactCache::clear() {
+    entries.clear();
+    events.clear();
+    touching.clear();
+    frame = 0;
+  }
+}
@@ -0,0 +1,75 @@
+#ifndef CONTACT_CACHE_H
+#define CONTACT_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "entities/EntityHandle.h"
+#include "libraries/constants/Constants.h"
+
+namespace Project::Systems {
+  enum class ContactEventType : uint8_t {
+    ENTER,
+    STAY,
+    EXIT
+  };
+
+  struct ContactEvent {
+    ContactEventType type = ContactEventType::ENTER;
+    Project::Entities::EntityHandle first;
+    Project::Entities::EntityHandle second;
+  };
+
+  class ContactCache {
+  public:
+    void beginFrame();
+    void add(Project::Entities::EntityHandle a, Project::Entities::EntityHandle b);
+    void endFrame();
+    void clear();
+
+    const std::vector<ContactEvent>& getEvents() const { return events; }
+    size_t size() const { return entries.size(); }
+
+    template <typename F>
+    void forEachContact(Project::Entities::EntityHandle handle, F&& callback) const;
+
+  private:
+    using PairKey = std::pair<uint64_t, uint64_t>;
+
+    struct PairKeyHash {
+      size_t operator()(const PairKey& key) const {
+        return std::hash<uint64_t>{}(key.first ^ (key.second * Project::Libraries::Constants::DEFAULT_HASH));
+      }
+    };
+
+    struct Entry {
+      uint64_t frame = 0;
+      bool touching = false;
+    };
+
+    std::unordered_map<PairKey, Entry, PairKeyHash> entries;
+    std::vector<ContactEvent> events;
+    std::vector<std::pair<uint64_t, Project::Entities::EntityHandle>> touching;
+    uint64_t frame = 0;
+  };
+
+  template <typename F>
+  void ContactCache::forEachContact(Project::Entities::EntityHandle handle, F&& callback) const {
+    const uint64_t key = handle.toKey();
+    auto it = std::lower_bound(touching.begin(), touching.end(), key,
+      [](const std::pair<uint64_t, Project::Entities::EntityHandle>& entry, uint64_t value) {
+        return entry.first < value;
+      });
+
+    for (; it != touching.end() && it->first == key; ++it) {
+      callback(it->second);
+    }
+  }
+}
+
+#endif
@@ -21,41 +21,47 @@ namespace Project::Systems {
 
   namespace Constants = Project::Libraries::Constants;
 
+  Project::Utilities::BroadPhaseType PhysicsSystem::defaultBroadPhaseType = Project::Utilities::BroadPhaseType::AUTO;
+
   PhysicsSystem::PhysicsSystem()
-  : quadtree(SDL_FRect{0.f, 0.f, static_cast<float>(Constants::INT_TEN_THOUSAND), static_cast<float>(Constants::INT_TEN_THOUSAND)}) {
+  : broadPhase(Project::Utilities::BroadPhase::create(defaultBroadPhaseType)) {
     components.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
     staticColliders.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
+    proxies.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
+    pairs.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
+    contacts.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
+    movedEntities.reserve(Project::Libraries::Constants::MAX_MEMORY_SPACE);
   }
 
   void Project::Systems::PhysicsSystem::add(PhysicsComponent* component) {
-    if (component) components.push_back(component);
+    components.insert(component);
   }
 
   void Project::Systems::PhysicsSystem::remove(PhysicsComponent* component) {
-    components.erase(std::remove(components.begin(), components.end(), component), components.end());
+    components.erase(component);
   }
 
   void Project::Systems::PhysicsSystem::addStaticCollider(BoundingBoxComponent* box) {
-    if (box) staticColliders.push_back(box);
+    staticColliders.insert(box);
   }
 
   void Project::Systems::PhysicsSystem::removeStaticCollider(BoundingBoxComponent* box) {
-    staticColliders.erase(std::remove(staticColliders.begin(), staticColliders.end(), box), staticColliders.end());
+    staticColliders.erase(box);
   }
 
   void Project::Systems::PhysicsSystem::update(float deltaTime) {
     PROFILE_SCOPE(Constants::PHYSICS_PROFILE);
-    grid.clear();
-    highPriorityGrid.clear();
-    lowPriorityGrid.clear();
+
+    contactCache.beginFrame();
+    for (auto* comp : components) {
+      if (comp && comp->isActive()) comp->integrate(deltaTime);
+    }
 
     SDL_FRect worldBounds{0.f, 0.f, 0.f, 0.f};
     bool hasWorldBounds = false;
 
-    auto accumulateBounds = [&](BoundingBoxComponent* box) {
-      if (!box || !box->isActive()) return;
-      SDL_FRect b{0.f, 0.f, 0.f, 0.f};
-      if (!computeBounds(box, b)) return;
+    auto accumulateBounds = [&](BoundingBoxComponent* box, const SDL_FRect& b) {
+      if (!box->isActive()) return;
       if (!hasWorldBounds) {
         worldBounds = b;
         hasWorldBounds = true;
@@ -64,16 +70,35 @@ namespace Project::Systems {
       }
     };
 
+    proxies.clear();
     for (auto* comp : components) {
       if (!comp || !comp->isActive()) continue;
-      auto* owner = comp->getOwner();
+      
+      Project::Entities::Entity* owner = comp->getOwner();
       if (!owner) continue;
-      auto* box = owner->getBoundingBoxComponent();
-      accumulateBounds(box);
+      
+      Project::Components::BoundingBoxComponent* box = owner->getBoundingBoxComponent();
+      if (!box) continue;
+      
+      SDL_FRect fBounds{0.f,0.f,0.f,0.f};
+      if (!computeBounds(box, fBounds)) continue;
+      accumulateBounds(box, fBounds);
+
+      Project::Utilities::Collider collider{box, comp, owner};
+      proxies.push_back({fBounds, collider, SDL_FPoint{comp->getVelocityX() * deltaTime, comp->getVelocityY() * deltaTime}});
     }
+    const size_t dynamicCount = proxies.size();
+    movingStatics.clear();
 
     for (auto* box : staticColliders) {
-      accumulateBounds(box);
+      if (!box || !box->isActive()) continue;
+
+      SDL_FRect fBounds{0.f, 0.f, 0.f, 0.f};
+      if (!computeBounds(box, fBounds)) continue;
+      accumulateBounds(box, fBounds);
+      Project::Entities::Entity* owner = box->getOwner();
+      if (owner && owner->getMotionComponent()) movingStatics.push_back(proxies.size());
+      proxies.push_back({fBounds, Project::Utilities::Collider{box, nullptr, owner}, SDL_FPoint{0.f, 0.f}});
     }
 
     if (!hasWorldBounds) {
@@ -87,61 +112,11 @@ namespace Project::Systems {
       if (worldBounds.h <= 0.f) worldBounds.h = 1.f;
     }
 
-    const size_t totalColliders = components.size() + staticColliders.size();
-    const float area = worldBounds.w * worldBounds.h;
-    float targetCell = std::sqrt(area / (static_cast<float>(totalColliders) + Constants::DEFAULT_WHOLE));
-    targetCell = std::clamp(targetCell, Constants::MIN_CELL, Constants::MAX_CELL);
-    
-    grid.setCellSize(targetCell);
-    highPriorityGrid.setCellSize(targetCell);
-    lowPriorityGrid.setCellSize(targetCell);
-
-    quadtree = Project::Utilities::QuadTree(worldBounds);
-    quadtree.clear();
-    bvh.clear();
-
-    std::vector<std::pair<SDL_FRect, Project::Utilities::Collider>> dynamicObjects;
-    dynamicObjects.reserve(components.size());
-    std::vector<std::pair<SDL_FRect, Project::Utilities::Collider>> allObjects;
-    allObjects.reserve(components.size() + staticColliders.size());
-
-    for (auto* comp : components) {
-      if (!comp || !comp->isActive()) continue;
-      
-      Project::Entities::Entity* owner = comp->getOwner();
-      if (!owner) continue;
-      
-      Project::Components::BoundingBoxComponent* box = owner->getBoundingBoxComponent();
-      if (!box) continue;
-      
-      SDL_FRect fBounds{0.f,0.f,0.f,0.f};
-      if (!computeBounds(box, fBounds)) continue;
-      SDL_Rect bounds{
-        static_cast<int>(std::floor(fBounds.x)),
-        static_cast<int>(std::floor(fBounds.y)),
-        static_cast<int>(std::ceil(fBounds.w)),
-        static_cast<int>(std::ceil(fBounds.h))
-      };
-      
-      Project::Utilities::Collider collider{box, comp, owner};
-      switch (comp->getUpdateFrequency()) {
-        case Project::Components::UpdateFrequency::HIGH:
-          highPriorityGrid.insert(collider, bounds);
-          break;
-        case Project::Components::UpdateFrequency::LOW:
-          lowPriorityGrid.insert(collider, bounds);
-          break;
-        default:
-          grid.insert(collider, bounds);
-          break;
-      }
-      
-      quadtree.insert(collider, fBounds);
-      dynamicObjects.emplace_back(fBounds, collider);
-      allObjects.emplace_back(fBounds, collider);
-
-      float centerX = worldBounds.x + worldBounds.w * Constants::CENTER_FACTOR;
-      float centerY = worldBounds.y + worldBounds.h * Constants::CENTER_FACTOR;
+    float centerX = worldBounds.x + worldBounds.w * Constants::CENTER_FACTOR;
+    float centerY = worldBounds.y + worldBounds.h * Constants::CENTER_FACTOR;
+    for (size_t i = 0; i < dynamicCount; ++i) {
+      PhysicsComponent* comp = proxies[i].collider.physics;
+      Project::Entities::Entity* owner = proxies[i].collider.entity;
       float dx = owner->getX() - centerX;
       float dy = owner->getY() - centerY;
       float dist = std::sqrt(dx * dx + dy * dy);
@@ -160,62 +135,186 @@ namespace Project::Systems {
         tick = (tick > Constants::HIGH_TICK_RATE ? tick : Constants::DEFAULT_TICK_RATE) * Constants::MID_TICK_MULTIPLIER;
       }
       comp->setTickRate(tick);
+    }
 
-      auto& catGrid = categoryGrids[owner->getEntityCategory()];
-      catGrid.setCellSize(targetCell);
-      catGrid.insert(collider, bounds);
+    auto start = std::chrono::high_resolution_clock::now();
+    broadPhase->build(proxies, worldBounds);
+    auto end = std::chrono::high_resolution_clock::now();
+    metrics.lastBroadPhaseMs = std::chrono::duration<float, std::milli>(end - start).count();
+
+    collectPairs(dynamicCount);
+    runNarrowPhase(deltaTime);
+    dispatchContacts(deltaTime);
+    recordMovingOverlaps();
+
+    for (auto* comp : components) {
+      if (comp && comp->isActive() && comp->requiresSweep()) comp->sweep(deltaTime);
     }
 
-    for (auto* box : staticColliders) {
-      if (!box || !box->isActive()) continue;
+    movedEntities.clear();
+    for (auto* comp : components) {
+      if (comp && comp->isActive()) {
+        comp->finishStep(deltaTime);
+        auto* owner = comp->getOwner();
+        if (owner && owner->consumeBoundsDirty()) {
+          movedEntities.push_back(owner->getHandle());
+        }
+      }
+    }
 
-      SDL_FRect fBounds{0.f, 0.f, 0.f, 0.f};
-      if (!computeBounds(box, fBounds)) continue;
-      SDL_Rect bounds{
-        static_cast<int>(std::floor(fBounds.x)),
-        static_cast<int>(std::floor(fBounds.y)),
-        static_cast<int>(std::ceil(fBounds.w)),
-        static_cast<int>(std::ceil(fBounds.h))
-      };
+    contactCache.endFrame();
+  }
+
+  void Project::Systems::PhysicsSystem::clear() {
+    components.clear();
+    staticColliders.clear();
+    movedEntities.clear();
+    proxies.clear();
+    pairs.clear();
+    contacts.clear();
+    movingStatics.clear();
+    contactCache.clear();
+    broadPhase->clear();
+  }
+
+  void Project::Systems::PhysicsSystem::setBroadPhaseType(Project::Utilities::BroadPhaseType type) {
+    if (broadPhase && broadPhase->getType() == type) return;
+    broadPhase = Project::Utilities::BroadPhase::create(type);
+  }
+
+  void PhysicsSystem::collectPairs(size_t dynamicCount) {
+    pairs.clear();
+
+    auto orient = [](Project::Utilities::ColliderPair& pair) {
+      if (pair.first.box == pair.second.box) return false;
+      const bool firstDynamic = pair.first.physics && !pair.first.physics->getStatic();
+      const bool secondDynamic = pair.second.physics && !pair.second.physics->getStatic();
+      if (!firstDynamic && !secondDynamic) return false;
+      if (!firstDynamic || (secondDynamic && pair.second.physics < pair.first.physics)) {
+        std::swap(pair.first, pair.second);
+      }
+      return !pair.first.physics->requiresSweep();
+    };
 
-      Project::Utilities::Collider collider{box, nullptr, box->getOwner()};
-      quadtree.insert(collider, fBounds);
-      allObjects.emplace_back(fBounds, collider);
-      if (collider.entity) {
-        auto& catGrid = categoryGrids[collider.entity->getEntityCategory()];
-        catGrid.setCellSize(targetCell);
-        catGrid.insert(collider, bounds);
+    if (broadPhase->collectPairs(pairs)) {
+      size_t kept = 0;
+      for (auto& pair : pairs) {
+        if (orient(pair)) pairs[kept++] = pair;
+      }
+      pairs.resize(kept);
+    } else {
+      for (size_t i = 0; i < dynamicCount; ++i) {
+        const auto& self = proxies[i].collider;
+        if (self.physics->getStatic() || self.physics->requiresSweep()) continue;
+
+        auto queryStart = std::chrono::high_resolution_clock::now();
+        broadPhase->query(proxies[i].bounds, candidates);
+        auto queryEnd = std::chrono::high_resolution_clock::now();
+        recordSpatialQuery(std::chrono::duration<float, std::milli>(queryEnd - queryStart).count());
+
+        for (const auto& other : candidates) {
+          Project::Utilities::ColliderPair pair{self, other};
+          if (orient(pair) && pair.first.box == self.box) pairs.push_back(pair);
+        }
       }
     }
 
+    std::sort(pairs.begin(), pairs.end(),
+      [](const Project::Utilities::ColliderPair& a, const Project::Utilities::ColliderPair& b) {
+        if (a.first.box != b.first.box) return a.first.box < b.first.box;
+        return a.second.box < b.second.box;
+      });
+
+    pairs.erase(std::unique(pairs.begin(), pairs.end(),
+      [](const Project::Utilities::ColliderPair& a, const Project::Utilities::ColliderPair& b) {
+        return a.first.box == b.first.box && a.second.box == b.second.box;
+      }), pairs.end());
+
+    metrics.pairCount = pairs.size();
+  }
+
+  void PhysicsSystem::runNarrowPhase(float deltaTime) {
     auto start = std::chrono::high_resolution_clock::now();
-    sweepPairs = Project::Utilities::SweepAndPrune::findPairs(dynamicObjects);
-    sweepPairKeys.clear();
-    sweepPairKeys.reserve(sweepPairs.size());
-    auto makeKey = [](PhysicsComponent* a, PhysicsComponent* b) {
-      auto pa = reinterpret_cast<std::uintptr_t>(a);
-      auto pb = reinterpret_cast<std::uintptr_t>(b);
-      if (pa > pb) std::swap(pa, pb);
-      return static_cast<std::size_t>(pa ^ (pb + Constants::DEFAULT_HASH + (pa << 6) + (pa >> 2)));
+    contacts.assign(pairs.size(), Contact{});
+
+    auto testRange = [this, deltaTime](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const auto& pair = pairs[i];
+        PhysicsComponent* physics = pair.first.physics;
+        Contact& contact = contacts[i];
+        contact.hit = physics->findContact(
+          pair.second,
+          physics->getVelocityX() * deltaTime,
+          physics->getVelocityY() * deltaTime,
+          contact.offset
+        );
+      }
     };
-    for (const auto& p : sweepPairs) {
-      sweepPairKeys.insert(makeKey(p.first.physics, p.second.physics));
+
+    const size_t chunkSize = Constants::NARROW_PHASE_CHUNK_SIZE;
+    if (pairs.size() <= chunkSize) {
+      testRange(0, pairs.size());
+    } else {
+      narrowPhaseGraph.clear();
+      for (size_t begin = 0; begin < pairs.size(); begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, pairs.size());
+        narrowPhaseGraph.add([testRange, begin, end]() { testRange(begin, end); });
+      }
+      narrowPhaseGraph.dispatch();
+      narrowPhaseGraph.wait();
     }
-    
-    bvh.build(allObjects);
+
     auto end = std::chrono::high_resolution_clock::now();
-    metrics.lastBroadPhaseMs = std::chrono::duration<float, std::milli>(end - start).count();
+    metrics.lastNarrowPhaseMs = std::chrono::duration<float, std::milli>(end - start).count();
+  }
 
-    for (auto* comp : components) {
-      if (comp && comp->isActive()) {
-        comp->update(deltaTime);
+  void PhysicsSystem::dispatchContacts(float deltaTime) {
+    size_t resolved = 0;
+    for (size_t i = 0; i < pairs.size(); ++i) {
+      if (!contacts[i].hit) continue;
+      const auto& pair = pairs[i];
+      PhysicsComponent* physics = pair.first.physics;
+      recordContact(pair.first.entity, pair.second.entity);
+
+      SDL_FPoint offset = contacts[i].offset;
+      const bool stale = physics->hasContacted() || (pair.second.physics && pair.second.physics->hasContacted());
+      if (stale && !physics->findContact(
+          pair.second,
+          physics->getVelocityX() * deltaTime,
+          physics->getVelocityY() * deltaTime,
+          offset)) {
+        continue;
       }
+
+      if (physics->resolveContact(pair.second, offset)) ++resolved;
     }
+    metrics.contactCount = resolved;
   }
 
-  void Project::Systems::PhysicsSystem::clear() {
-    components.clear();
-    staticColliders.clear();
+  void PhysicsSystem::recordMovingOverlaps() {
+    for (size_t index : movingStatics) {
+      const auto& self = proxies[index].collider;
+      if (!self.entity) continue;
+
+      auto queryStart = std::chrono::high_resolution_clock::now();
+      broadPhase->query(proxies[index].bounds, candidates);
+      auto queryEnd = std::chrono::high_resolution_clock::now();
+      recordSpatialQuery(std::chrono::duration<float, std::milli>(queryEnd - queryStart).count());
+
+      for (const auto& other : candidates) {
+        if (!other.box || other.box == self.box) continue;
+        Project::Entities::Entity* otherEntity = other.physics ? other.physics->getOwner() : other.entity;
+        if (!otherEntity) continue;
+        if (self.box->isIgnoring(otherEntity->getEntityName())) continue;
+        if (other.box->isIgnoring(self.entity->getEntityName())) continue;
+        if (self.box->intersects(*other.box)) recordContact(self.entity, otherEntity);
+      }
+    }
+  }
+
+  void PhysicsSystem::recordContact(Project::Entities::Entity* a, Project::Entities::Entity* b) {
+    if (!a || !b) return;
+    contactCache.add(a->getHandle(), b->getHandle());
   }
 
   void Project::Systems::PhysicsSystem::recordSpatialQuery(float ms) {
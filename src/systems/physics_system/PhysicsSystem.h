@@ -2,14 +2,18 @@
 #define PHYSICS_SYSTEM_H
 
 #include <chrono>
-#include <unordered_map>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
+#include "ContactCache.h"
+
+#include "helpers/dense_set/DenseSet.h"
 #include "interfaces/update_interface/Updatable.h"
-#include "utilities/spatial/QuadTree.h"
-#include "utilities/spatial/BVH.h"
-#include "entities/EntityCategory.h"
-#include "utilities/spatial/SweepAndPrune.h"
+#include "entities/EntityHandle.h"
+#include "utilities/spatial/BroadPhase.h"
+#include "utilities/spatial/BroadPhaseType.h"
+#include "utilities/thread/TaskGraph.h"
 
 namespace Project { namespace Components { class PhysicsComponent; } }
 
@@ -20,6 +24,9 @@ namespace Project::Systems {
       std::size_t queryCount = 0;
       float totalQueryTimeMs = 0.0f;
       float lastBroadPhaseMs = 0.0f;
+      float lastNarrowPhaseMs = 0.0f;
+      std::size_t pairCount = 0;
+      std::size_t contactCount = 0;
     };
 
     PhysicsSystem();
@@ -33,41 +40,58 @@ namespace Project::Systems {
     void update(float deltaTime) override;
     void clear();
 
-    const Project::Utilities::SpatialHashGrid& getGrid() const { return grid; }
-    Project::Utilities::SpatialHashGrid& getGrid() { return grid; }
-    const Project::Utilities::SpatialHashGrid& getHighPriorityGrid() const { return highPriorityGrid; }
-    Project::Utilities::SpatialHashGrid& getHighPriorityGrid() { return highPriorityGrid; }
-    const Project::Utilities::SpatialHashGrid& getLowPriorityGrid() const { return lowPriorityGrid; }
-    Project::Utilities::SpatialHashGrid& getLowPriorityGrid() { return lowPriorityGrid; }
-    const Project::Utilities::QuadTree& getQuadTree() const { return quadtree; }
-    Project::Utilities::QuadTree& getQuadTree() { return quadtree; }
-    const Project::Utilities::BVH& getBVH() const { return bvh; }
-    Project::Utilities::BVH& getBVH() { return bvh; }
-    const std::vector<Project::Utilities::SweepAndPrune::Pair>& getSweepPairs() const { return sweepPairs; }
-    const std::unordered_set<std::size_t>& getSweepPairKeys() const { return sweepPairKeys; }
+    const Project::Utilities::BroadPhase& getBroadPhase() const { return *broadPhase; }
+    Project::Utilities::BroadPhaseType getBroadPhaseType() const { return broadPhase->getType(); }
+    void setBroadPhaseType(Project::Utilities::BroadPhaseType type);
+
+    static void setDefaultBroadPhaseType(Project::Utilities::BroadPhaseType type) { defaultBroadPhaseType = type; }
+    static Project::Utilities::BroadPhaseType getDefaultBroadPhaseType() { return defaultBroadPhaseType; }
+
+    const std::vector<Project::Entities::EntityHandle>& getMovedEntities() const { return movedEntities; }
+    const std::vector<Project::Utilities::ColliderPair>& getPairs() const { return pairs; }
+    const ContactCache& getContactCache() const { return contactCache; }
+    const std::vector<ContactEvent>& getContactEvents() const { return contactCache.getEvents(); }
+    void recordContact(Project::Entities::Entity* a, Project::Entities::Entity* b);
 
     const PerformanceMetrics& getPerformanceMetrics() const { return metrics; }
     void recordSpatialQuery(float ms);
 
   private:
+    struct Contact {
+      SDL_FPoint offset{0.f, 0.f};
+      bool hit = false;
+    };
+
     PerformanceMetrics metrics;
-    Project::Utilities::QuadTree quadtree;
-    Project::Utilities::BVH bvh;
-    
-    Project::Utilities::SpatialHashGrid grid;
-    Project::Utilities::SpatialHashGrid highPriorityGrid;
-    Project::Utilities::SpatialHashGrid lowPriorityGrid;
-    std::unordered_map<Project::Entities::EntityCategory, Project::Utilities::SpatialHashGrid> categoryGrids;
-
-    std::vector<Project::Utilities::SweepAndPrune::Pair> sweepPairs;
-    std::unordered_set<std::size_t> sweepPairKeys;
-    
-    std::vector<Project::Components::PhysicsComponent*> components;
-    std::vector<Project::Components::BoundingBoxComponent*> staticColliders;
+
+    std::unique_ptr<Project::Utilities::BroadPhase> broadPhase;
+    std::vector<Project::Utilities::BroadPhaseProxy> proxies;
+    std::vector<Project::Utilities::ColliderPair> pairs;
+    std::vector<Contact> contacts;
+    std::vector<Project::Utilities::Collider> candidates;
+    std::vector<size_t> movingStatics;
+    Project::Utilities::TaskGraph narrowPhaseGraph;
+    ContactCache contactCache;
+    static Project::Utilities::BroadPhaseType defaultBroadPhaseType;
+
+    Project::Helpers::DenseSet<Project::Components::PhysicsComponent> components;
+    Project::Helpers::DenseSet<Project::Components::BoundingBoxComponent> staticColliders;
+    std::vector<Project::Entities::EntityHandle> movedEntities;
 
     SDL_FRect unionRect(const SDL_FRect& a, const SDL_FRect& b) const;
     bool computeBounds(Project::Components::BoundingBoxComponent* box, SDL_FRect& bounds) const;
-    void resetMetrics() { metrics.queryCount = 0; metrics.totalQueryTimeMs = 0.0f; metrics.lastBroadPhaseMs = 0.0f; }
+    void collectPairs(size_t dynamicCount);
+    void runNarrowPhase(float deltaTime);
+    void dispatchContacts(float deltaTime);
+    void recordMovingOverlaps();
+    void resetMetrics() {
+      metrics.queryCount = 0;
+      metrics.totalQueryTimeMs = 0.0f;
+      metrics.lastBroadPhaseMs = 0.0f;
+      metrics.lastNarrowPhaseMs = 0.0f;
+      metrics.pairCount = 0;
+      metrics.contactCount = 0;
+    }
   };
 }
 
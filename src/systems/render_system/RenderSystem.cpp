@@ -17,11 +17,11 @@ namespace Project::Systems {
   }
 
   void RenderSystem::add(GraphicsComponent* component) {
-    if (component) components.push_back(component);
+    components.insert(component);
   }
 
   void RenderSystem::remove(GraphicsComponent* component) {
-    components.erase(std::remove(components.begin(), components.end(), component), components.end());
+    components.erase(component);
   }
 
   void RenderSystem::update(float deltaTime) {
@@ -83,11 +83,13 @@ namespace Project::Systems {
   }
 
   void RenderSystem::drawBuffer(const std::vector<GraphicsComponent*>& buffer) {
+    if (buffer.empty()) return;
+    batcher.begin(buffer.front()->getRenderer());
     for (auto* comp : buffer) {
       if (comp && comp->isActive() && comp->isInCameraView()) {
-        comp->render();
-        Project::Utilities::Profiler::getInstance().incrementDrawCalls();
+        comp->render(batcher);
       }
     }
+    batcher.end();
   }
 }
@@ -4,9 +4,11 @@
 #include <vector>
 #include <SDL.h>
 
+#include "helpers/dense_set/DenseSet.h"
 #include "interfaces/render_interface/Renderable.h"
 #include "interfaces/update_interface/Updatable.h"
 #include "libraries/constants/IndexConstants.h"
+#include "utilities/texture/SpriteBatcher.h"
 
 namespace Project { namespace Components { class GraphicsComponent; } }
 
@@ -23,7 +25,8 @@ namespace Project::Systems {
     void clear();
 
   private:
-    std::vector<Project::Components::GraphicsComponent*> components;
+    Project::Utilities::SpriteBatcher batcher;
+    Project::Helpers::DenseSet<Project::Components::GraphicsComponent> components;
     std::vector<Project::Components::GraphicsComponent*> commandBuffers[Project::Libraries::Constants::INDEX_TWO];
     int readIndex = 0;
     int writeIndex = Project::Libraries::Constants::INDEX_ONE;
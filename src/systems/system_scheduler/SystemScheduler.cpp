@@ -1,47 +1,59 @@
 #include "SystemScheduler.h"
 
 #include <queue>
-#include "utilities/thread/ThreadPool.h"
 
 namespace Project::Systems {
+  using Project::Utilities::JobHandle;
+
   void SystemScheduler::addSystem(const std::string& name, Project::Interfaces::Updatable* system, const std::vector<std::string>& dependencies) {
     systems.push_back(Node{name, system, dependencies});
     dirty = true;
   }
 
   void SystemScheduler::clear() {
+    graph.clear();
     systems.clear();
-    layers.clear();
     dirty = true;
   }
 
   void SystemScheduler::resolveOrder() {
     if (!dirty) return;
-    layers.clear();
+    graph.clear();
+
     std::unordered_map<std::string, size_t> indegree;
-    std::unordered_map<std::string, std::vector<std::string>> graph;
+    std::unordered_map<std::string, std::vector<std::string>> edges;
     for (const auto& node : systems) {
       indegree[node.name];
       for (const auto& dep : node.deps) {
-        graph[dep].push_back(node.name);
+        edges[dep].push_back(node.name);
         ++indegree[node.name];
       }
     }
-    std::queue<std::pair<std::string, size_t>> q;
+
+    std::queue<std::string> q;
     for (auto& [name, deg] : indegree) {
-      if (deg == 0) q.push({name, 0});
+      if (deg == 0) q.push(name);
     }
+
     std::unordered_map<std::string, Node*> lookup;
     for (auto& node : systems) lookup[node.name] = &node;
+
+    std::unordered_map<std::string, JobHandle> handles;
     while (!q.empty()) {
-      auto [cur, level] = q.front();
+      std::string cur = q.front();
       q.pop();
-      if (lookup[cur] && lookup[cur]->system) {
-        if (layers.size() <= level) layers.resize(level + 1);
-        layers[level].push_back(lookup[cur]->system);
+      auto it = lookup.find(cur);
+      if (it != lookup.end() && it->second->system) {
+        auto* sys = it->second->system;
+        JobHandle handle = graph.add([this, sys]() { sys->update(currentDelta); });
+        for (const auto& dep : it->second->deps) {
+          auto depIt = handles.find(dep);
+          if (depIt != handles.end()) graph.precede(depIt->second, handle);
+        }
+        handles[cur] = handle;
       }
-      for (const auto& next : graph[cur]) {
-        if (--indegree[next] == 0) q.push({next, level + 1});
+      for (const auto& next : edges[cur]) {
+        if (--indegree[next] == 0) q.push(next);
       }
     }
     dirty = false;
@@ -49,14 +61,8 @@ namespace Project::Systems {
 
   void SystemScheduler::update(float deltaTime) {
     resolveOrder();
-    auto& pool = Project::Utilities::ThreadPool::getInstance();
-    
-    for (auto& layer : layers) {
-      for (auto* sys : layer) {
-        if (!sys) continue;
-        pool.enqueue([sys, deltaTime]() { sys->update(deltaTime); });
-      }
-      pool.wait();
-    }
+    currentDelta = deltaTime;
+    graph.dispatch();
+    graph.wait();
   }
 }
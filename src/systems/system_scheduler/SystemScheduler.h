@@ -6,6 +6,7 @@
 #include <unordered_map>
 
 #include "interfaces/update_interface/Updatable.h"
+#include "utilities/thread/TaskGraph.h"
 
 namespace Project::Systems {
   class SystemScheduler {
@@ -22,7 +23,8 @@ namespace Project::Systems {
     };
 
     std::vector<Node> systems;
-    std::vector<std::vector<Project::Interfaces::Updatable*>> layers;
+    Project::Utilities::TaskGraph graph;
+    float currentDelta = 0.0f;
     bool dirty = true;
 
     void resolveOrder();
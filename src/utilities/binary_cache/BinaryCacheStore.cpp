@@ -0,0 +1,390 @@
+#include "BinaryCacheStore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "helpers/serialization/EndianHelper.h"
+#include "libraries/constants/NumericConstants.h"
+#include "libraries/constants/PathConstants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+  namespace Helpers = Project::Helpers;
+  namespace fs = std::filesystem;
+
+  static constexpr std::uint64_t HEADER_SIZE = sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t);
+  static constexpr std::uint64_t RECORD_FIXED_SIZE = sizeof(std::uint32_t) + sizeof(std::uint64_t) * 3;
+
+  template <typename T>
+  static bool readValue(const unsigned char* base, std::uint64_t length, std::uint64_t& position, T& value) {
+    if (position + sizeof(T) > length) return false;
+    T raw;
+    std::memcpy(&raw, base + position, sizeof(T));
+    value = Helpers::littleEndianToHost(raw);
+    position += sizeof(T);
+    return true;
+  }
+
+  static void writeHeader(std::ostream& out, std::uint64_t generation) {
+    Helpers::writeLittleEndian(out, Constants::CACHE_STORE_MAGIC);
+    Helpers::writeLittleEndian(out, Constants::CACHE_STORE_VERSION);
+    Helpers::writeLittleEndian(out, generation);
+  }
+
+  static void writeRecord(std::ostream& out, std::uint32_t type, const std::string& key, long long timestamp, const char* data, std::uint64_t size) {
+    Helpers::writeLittleEndian(out, type);
+    Helpers::writeLittleEndian(out, static_cast<std::uint64_t>(key.size()));
+    out.write(key.data(), static_cast<std::streamsize>(key.size()));
+    Helpers::writeLittleEndian(out, static_cast<std::int64_t>(timestamp));
+    Helpers::writeLittleEndian(out, size);
+    if (size > 0) out.write(data, static_cast<std::streamsize>(size));
+  }
+
+  std::shared_ptr<BinaryCacheStore> BinaryCacheStore::open(const std::string& filePath) {
+    static std::mutex registryMutex;
+    static std::unordered_map<std::string, std::weak_ptr<BinaryCacheStore>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& slot = registry[filePath];
+    if (auto existing = slot.lock()) return existing;
+    auto store = std::make_shared<BinaryCacheStore>(filePath);
+    slot = store;
+    return store;
+  }
+
+  BinaryCacheStore::BinaryCacheStore(const std::string& filePath)
+    : dataPath(filePath), indexPath(filePath + Constants::CACHE_INDEX_EXTENSION) {
+    std::error_code ec;
+    const fs::path parent = fs::path(dataPath).parent_path();
+    if (!parent.empty()) fs::create_directories(parent, ec);
+    openFiles();
+  }
+
+  BinaryCacheStore::~BinaryCacheStore() {
+    flush();
+  }
+
+  bool BinaryCacheStore::get(const std::string& key, long long timestamp, std::vector<char>& outData) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end() || it->second.timestamp != timestamp) return false;
+
+    const Entry& entry = it->second;
+    if (!mapRange(entry.offset + entry.size)) return false;
+    const char* begin = reinterpret_cast<const char*>(mapping->data() + entry.offset);
+    outData.assign(begin, begin + entry.size);
+    return true;
+  }
+
+  bool BinaryCacheStore::put(const std::string& key, long long timestamp, const std::vector<char>& data) {
+    if (key.size() > Constants::MAX_PATH_SIZE) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end() && it->second.timestamp == timestamp && it->second.size == data.size() &&
+        mapRange(it->second.offset + it->second.size) &&
+        (data.empty() || std::memcmp(mapping->data() + it->second.offset, data.data(), data.size()) == 0)) {
+      return true;
+    }
+    return append(RecordType::PUT, key, timestamp, &data);
+  }
+
+  void BinaryCacheStore::erase(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index.find(key) == index.end()) return;
+    append(RecordType::ERASE, key, 0, nullptr);
+  }
+
+  void BinaryCacheStore::refresh() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::error_code ec;
+    const std::uint64_t size = fs::file_size(dataPath, ec);
+    if (ec || size < fileLength) {
+      openFiles();
+      return;
+    }
+    if (size == fileLength) return;
+
+    mapping.reset();
+    if (mapRange(size)) scanRecords(fileLength);
+  }
+
+  void BinaryCacheStore::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::uint64_t liveBytes = fileLength - std::min(fileLength, HEADER_SIZE + deadBytes);
+    if (deadBytes >= Constants::CACHE_COMPACT_MIN_BYTES && deadBytes > liveBytes) {
+      compactLocked();
+    }
+    if (indexDirty) writeIndex();
+  }
+
+  void BinaryCacheStore::compact() {
+    std::lock_guard<std::mutex> lock(mutex);
+    compactLocked();
+    if (indexDirty) writeIndex();
+  }
+
+  size_t BinaryCacheStore::getEntryCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.size();
+  }
+
+  std::uint64_t BinaryCacheStore::getDeadBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return deadBytes;
+  }
+
+  std::uint64_t BinaryCacheStore::recordSize(size_t keySize, std::uint64_t dataSize) {
+    return RECORD_FIXED_SIZE + keySize + dataSize;
+  }
+
+  std::uint64_t BinaryCacheStore::nextGeneration() {
+    return static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+  }
+
+  void BinaryCacheStore::openFiles() {
+    mapping.reset();
+    index.clear();
+    deadBytes = 0;
+
+    std::error_code ec;
+    if (!fs::exists(dataPath, ec)) {
+      resetFile();
+      return;
+    }
+
+    mapping = std::make_unique<MemoryMappedFile>(dataPath);
+    if (!mapping->isValid() || mapping->size() < HEADER_SIZE) {
+      resetFile();
+      return;
+    }
+
+    std::uint64_t position = 0;
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    const std::uint64_t length = mapping->size();
+    readValue(mapping->data(), length, position, magic);
+    readValue(mapping->data(), length, position, version);
+    readValue(mapping->data(), length, position, generation);
+    if (magic != Constants::CACHE_STORE_MAGIC || version != Constants::CACHE_STORE_VERSION) {
+      resetFile();
+      return;
+    }
+
+    fileLength = length;
+    std::uint64_t coveredLength = HEADER_SIZE;
+    if (!loadIndex(coveredLength)) {
+      index.clear();
+      deadBytes = 0;
+      coveredLength = HEADER_SIZE;
+      indexDirty = true;
+    }
+    scanRecords(coveredLength);
+  }
+
+  void BinaryCacheStore::resetFile() {
+    mapping.reset();
+    index.clear();
+    deadBytes = 0;
+    generation = nextGeneration();
+
+    std::ofstream out(dataPath, std::ios::binary | std::ios::trunc);
+    if (out.is_open()) writeHeader(out, generation);
+    fileLength = out ? HEADER_SIZE : 0;
+
+    std::error_code ec;
+    fs::remove(indexPath, ec);
+    indexDirty = true;
+  }
+
+  bool BinaryCacheStore::loadIndex(std::uint64_t& coveredLength) {
+    std::ifstream in(indexPath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    std::uint64_t indexGeneration = 0;
+    std::uint64_t covered = 0;
+    std::uint64_t dead = 0;
+    std::uint64_t count = 0;
+    if (!Helpers::readLittleEndian(in, magic) || magic != Constants::CACHE_INDEX_MAGIC) return false;
+    if (!Helpers::readLittleEndian(in, version) || version != Constants::CACHE_STORE_VERSION) return false;
+    if (!Helpers::readLittleEndian(in, indexGeneration) || indexGeneration != generation) return false;
+    if (!Helpers::readLittleEndian(in, covered) || covered < HEADER_SIZE || covered > fileLength) return false;
+    if (!Helpers::readLittleEndian(in, dead) || !Helpers::readLittleEndian(in, count)) return false;
+
+    index.reserve(static_cast<size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::uint64_t keySize = 0;
+      if (!Helpers::readLittleEndian(in, keySize) || keySize > Constants::MAX_PATH_SIZE) return false;
+      std::string key(keySize, '\0');
+      in.read(key.data(), static_cast<std::streamsize>(keySize));
+
+      std::int64_t timestamp = 0;
+      Entry entry;
+      if (!Helpers::readLittleEndian(in, timestamp) ||
+          !Helpers::readLittleEndian(in, entry.offset) ||
+          !Helpers::readLittleEndian(in, entry.size)) {
+        return false;
+      }
+      if (entry.offset < HEADER_SIZE || entry.offset + entry.size > covered) return false;
+      entry.timestamp = timestamp;
+      index[key] = entry;
+    }
+
+    deadBytes = dead;
+    coveredLength = covered;
+    indexDirty = false;
+    return true;
+  }
+
+  void BinaryCacheStore::writeIndex() {
+    std::ofstream out(indexPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return;
+
+    Helpers::writeLittleEndian(out, Constants::CACHE_INDEX_MAGIC);
+    Helpers::writeLittleEndian(out, Constants::CACHE_STORE_VERSION);
+    Helpers::writeLittleEndian(out, generation);
+    Helpers::writeLittleEndian(out, fileLength);
+    Helpers::writeLittleEndian(out, deadBytes);
+    Helpers::writeLittleEndian(out, static_cast<std::uint64_t>(index.size()));
+    for (const auto& [key, entry] : index) {
+      Helpers::writeLittleEndian(out, static_cast<std::uint64_t>(key.size()));
+      out.write(key.data(), static_cast<std::streamsize>(key.size()));
+      Helpers::writeLittleEndian(out, static_cast<std::int64_t>(entry.timestamp));
+      Helpers::writeLittleEndian(out, entry.offset);
+      Helpers::writeLittleEndian(out, entry.size);
+    }
+    if (out) indexDirty = false;
+  }
+
+  void BinaryCacheStore::scanRecords(std::uint64_t position) {
+    if (!mapping || !mapping->isValid()) return;
+    const unsigned char* base = mapping->data();
+    const std::uint64_t length = mapping->size();
+    std::uint64_t end = position;
+
+    while (position < length) {
+      std::uint32_t type = 0;
+      std::uint64_t keySize = 0;
+      if (!readValue(base, length, position, type) || !readValue(base, length, position, keySize)) break;
+      if (keySize > Constants::MAX_PATH_SIZE || keySize > length - position) break;
+      std::string key(reinterpret_cast<const char*>(base + position), static_cast<size_t>(keySize));
+      position += keySize;
+
+      std::int64_t timestamp = 0;
+      std::uint64_t dataSize = 0;
+      if (!readValue(base, length, position, timestamp) || !readValue(base, length, position, dataSize)) break;
+      if (dataSize > length - position) break;
+      const std::uint64_t dataOffset = position;
+      position += dataSize;
+
+      auto it = index.find(key);
+      if (type == static_cast<std::uint32_t>(RecordType::PUT)) {
+        if (it != index.end()) deadBytes += recordSize(key.size(), it->second.size);
+        index[key] = Entry{timestamp, dataOffset, dataSize};
+      } else if (type == static_cast<std::uint32_t>(RecordType::ERASE)) {
+        if (it != index.end()) {
+          deadBytes += recordSize(key.size(), it->second.size);
+          index.erase(it);
+        }
+        deadBytes += recordSize(key.size(), dataSize);
+      } else {
+        break;
+      }
+      end = position;
+      indexDirty = true;
+    }
+
+    fileLength = end;
+    if (end < length) {
+      mapping.reset();
+      std::error_code ec;
+      fs::resize_file(dataPath, end, ec);
+      indexDirty = true;
+    }
+  }
+
+  bool BinaryCacheStore::mapRange(std::uint64_t end) {
+    if (!mapping || !mapping->isValid() || mapping->size() < end) {
+      mapping = std::make_unique<MemoryMappedFile>(dataPath);
+    }
+    return mapping->isValid() && mapping->size() >= end;
+  }
+
+  bool BinaryCacheStore::append(RecordType type, const std::string& key, long long timestamp, const std::vector<char>* data) {
+    mapping.reset();
+    std::ofstream out(dataPath, std::ios::binary | std::ios::app);
+    if (!out.is_open()) return false;
+
+    const std::uint64_t size = data ? data->size() : 0;
+    writeRecord(out, static_cast<std::uint32_t>(type), key, timestamp, data ? data->data() : nullptr, size);
+    out.flush();
+    if (!out) return false;
+
+    auto it = index.find(key);
+    if (it != index.end()) deadBytes += recordSize(key.size(), it->second.size);
+
+    const std::uint64_t dataOffset = fileLength + recordSize(key.size(), 0);
+    if (type == RecordType::PUT) {
+      index[key] = Entry{timestamp, dataOffset, size};
+    } else {
+      if (it != index.end()) index.erase(it);
+      deadBytes += recordSize(key.size(), size);
+    }
+    fileLength += recordSize(key.size(), size);
+    indexDirty = true;
+    return true;
+  }
+
+  void BinaryCacheStore::compactLocked() {
+    if (deadBytes == 0 || !mapRange(fileLength)) return;
+
+    const std::string tempPath = dataPath + Constants::CACHE_TEMP_EXTENSION;
+    const std::uint64_t newGeneration = nextGeneration();
+    std::vector<std::pair<const std::string*, const Entry*>> ordered;
+    ordered.reserve(index.size());
+    for (const auto& [key, entry] : index) {
+      ordered.emplace_back(&key, &entry);
+    }
+    std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.second->offset < b.second->offset; });
+
+    std::unordered_map<std::string, Entry> compacted;
+    compacted.reserve(index.size());
+    std::uint64_t position = HEADER_SIZE;
+    {
+      std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+      if (!out.is_open()) return;
+      writeHeader(out, newGeneration);
+      for (const auto& [key, entry] : ordered) {
+        const char* data = reinterpret_cast<const char*>(mapping->data() + entry->offset);
+        writeRecord(out, static_cast<std::uint32_t>(RecordType::PUT), *key, entry->timestamp, data, entry->size);
+        compacted[*key] = Entry{entry->timestamp, position + recordSize(key->size(), 0), entry->size};
+        position += recordSize(key->size(), entry->size);
+      }
+      out.close();
+      if (!out) {
+        std::error_code ec;
+        fs::remove(tempPath, ec);
+        return;
+      }
+    }
+
+    mapping.reset();
+    std::error_code ec;
+    fs::rename(tempPath, dataPath, ec);
+    if (ec) {
+      fs::remove(tempPath, ec);
+      return;
+    }
+
+    index = std::move(compacted);
+    generation = newGeneration;
+    fileLength = position;
+    deadBytes = 0;
+    indexDirty = true;
+  }
+}
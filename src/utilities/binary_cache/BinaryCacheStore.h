@@ -0,0 +1,70 @@
+#ifndef BINARY_CACHE_STORE_H
+#define BINARY_CACHE_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utilities/memory/MemoryMappedFile.h"
+
+namespace Project::Utilities {
+  class BinaryCacheStore {
+  public:
+    static std::shared_ptr<BinaryCacheStore> open(const std::string& filePath);
+
+    explicit BinaryCacheStore(const std::string& filePath);
+    ~BinaryCacheStore();
+
+    BinaryCacheStore(const BinaryCacheStore&) = delete;
+    BinaryCacheStore& operator=(const BinaryCacheStore&) = delete;
+
+    bool get(const std::string& key, long long timestamp, std::vector<char>& outData);
+    bool put(const std::string& key, long long timestamp, const std::vector<char>& data);
+    void erase(const std::string& key);
+
+    void refresh();
+    void flush();
+    void compact();
+
+    size_t getEntryCount() const;
+    std::uint64_t getDeadBytes() const;
+
+  private:
+    enum class RecordType : std::uint32_t { PUT = 1, ERASE = 2 };
+
+    struct Entry {
+      long long timestamp = 0;
+      std::uint64_t offset = 0;
+      std::uint64_t size = 0;
+    };
+
+    std::unordered_map<std::string, Entry> index;
+    std::unique_ptr<MemoryMappedFile> mapping;
+    std::string dataPath;
+    std::string indexPath;
+
+    std::uint64_t generation = 0;
+    std::uint64_t fileLength = 0;
+    std::uint64_t deadBytes = 0;
+    bool indexDirty = false;
+
+    mutable std::mutex mutex;
+
+    static std::uint64_t recordSize(size_t keySize, std::uint64_t dataSize);
+    static std::uint64_t nextGeneration();
+
+    void openFiles();
+    void resetFile();
+    bool loadIndex(std::uint64_t& coveredLength);
+    void writeIndex();
+    void scanRecords(std::uint64_t position);
+    bool mapRange(std::uint64_t end);
+    bool append(RecordType type, const std::string& key, long long timestamp, const std::vector<char>* data);
+    void compactLocked();
+  };
+}
+
+#endif
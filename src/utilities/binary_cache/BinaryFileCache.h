@@ -1,10 +1,12 @@
 #ifndef BINARY_FILE_CACHE_H
 #define BINARY_FILE_CACHE_H
 
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "BinaryCacheStore.h"
+
 namespace Project::Utilities {
   class BinaryFileCache {
   public:
@@ -12,13 +14,14 @@ namespace Project::Utilities {
 
     void load();
     void save() const;
+    void compact();
 
     bool getData(const std::string& path, std::vector<char>& outData) const;
-    void setData(const std::string& path, const std::vector<char>& data);
+    bool setData(const std::string& path, const std::vector<char>& data);
     void removeData(const std::string& path);
 
   private:
-    std::unordered_map<std::string, std::pair<long long, std::vector<char>>> cache;
+    std::shared_ptr<BinaryCacheStore> store;
     std::string cacheFilePath;
     
     static long long getTimestamp(const std::string& path);
@@ -0,0 +1,162 @@
+#include "VisibilityPolygon.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  namespace {
+    float cross(const SDL_FPoint& a, const SDL_FPoint& b) {
+      return a.x * b.y - a.y * b.x;
+    }
+  }
+
+  void VisibilityPolygon::begin(const SDL_FPoint& _origin, float _radius) {
+    origin = _origin;
+    radius = _radius;
+    segments.clear();
+  }
+
+  void VisibilityPolygon::addRect(const SDL_FRect& rect, Project::Entities::Entity* owner) {
+    if (origin.x > rect.x && origin.x < rect.x + rect.w && origin.y > rect.y && origin.y < rect.y + rect.h) return;
+
+    const float nearX = std::clamp(origin.x, rect.x, rect.x + rect.w);
+    const float nearY = std::clamp(origin.y, rect.y, rect.y + rect.h);
+    const float dx = nearX - origin.x;
+    const float dy = nearY - origin.y;
+    if (dx * dx + dy * dy > radius * radius) return;
+
+    const SDL_FPoint tl{rect.x, rect.y};
+    const SDL_FPoint tr{rect.x + rect.w, rect.y};
+    const SDL_FPoint br{rect.x + rect.w, rect.y + rect.h};
+    const SDL_FPoint bl{rect.x, rect.y + rect.h};
+    addSegment(tl, tr, owner);
+    addSegment(tr, br, owner);
+    addSegment(br, bl, owner);
+    addSegment(bl, tl, owner);
+  }
+
+  void VisibilityPolygon::addSegment(const SDL_FPoint& a, const SDL_FPoint& b, Project::Entities::Entity* owner) {
+    segments.push_back(OccluderSegment{a, b, owner});
+  }
+
+  void VisibilityPolygon::compute(float startDegrees, float endDegrees, int arcSamples,
+    std::vector<SDL_FPoint>& outPoints, std::vector<Project::Entities::Entity*>* outHits) {
+    outPoints.clear();
+    if (outHits) outHits->clear();
+
+    const float twoPi = Constants::ANGLE_TWO_PI_RAD;
+    const float eps = Constants::VISIBILITY_ANGLE_EPSILON;
+    const float base = startDegrees * Constants::DEG_TO_RAD;
+    const float span = std::clamp((endDegrees - startDegrees) * Constants::DEG_TO_RAD, 0.f, twoPi);
+    const bool fullCircle = span >= twoPi - eps;
+
+    auto relative = [&](float angle) {
+      float r = std::fmod(angle - base, twoPi);
+      return r < 0.f ? r + twoPi : r;
+    };
+    auto addAngle = [&](float rel) {
+      if (rel >= 0.f && rel <= span) angles.push_back(rel);
+    };
+    auto addAround = [&](float rel) {
+      addAngle(rel - eps);
+      addAngle(rel);
+      addAngle(rel + eps);
+      if (fullCircle && rel < eps) addAngle(rel + twoPi - eps);
+    };
+
+    intervals.clear();
+    angles.clear();
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+      const SDL_FPoint p{segments[i].a.x - origin.x, segments[i].a.y - origin.y};
+      const SDL_FPoint q{segments[i].b.x - origin.x, segments[i].b.y - origin.y};
+      const float c = cross(p, q);
+      if (std::abs(c) < Constants::RAYCAST_EPSILON) continue;
+
+      const SDL_FPoint& first = c > 0.f ? p : q;
+      const float start = relative(std::atan2(first.y, first.x));
+      const float delta = std::atan2(std::abs(c), p.x * q.x + p.y * q.y);
+      if (start + delta <= twoPi) {
+        intervals.push_back(Interval{start, start + delta, i});
+      } else {
+        intervals.push_back(Interval{start, twoPi, i});
+        intervals.push_back(Interval{0.f, start + delta - twoPi, i});
+      }
+
+      addAround(relative(std::atan2(p.y, p.x)));
+      addAround(relative(std::atan2(q.y, q.x)));
+
+      const SDL_FPoint e{q.x - p.x, q.y - p.y};
+      const float a = e.x * e.x + e.y * e.y;
+      const float b = Constants::DEFAULT_DOUBLE * (p.x * e.x + p.y * e.y);
+      const float k = p.x * p.x + p.y * p.y - radius * radius;
+      const float disc = b * b - Constants::DEFAULT_DOUBLE * Constants::DEFAULT_DOUBLE * a * k;
+      if (a > 0.f && disc >= 0.f) {
+        const float root = std::sqrt(disc);
+        for (float t : {(-b - root) / (Constants::DEFAULT_DOUBLE * a), (-b + root) / (Constants::DEFAULT_DOUBLE * a)}) {
+          if (t < 0.f || t > Constants::DEFAULT_WHOLE) continue;
+          addAround(relative(std::atan2(p.y + e.y * t, p.x + e.x * t)));
+        }
+      }
+    }
+
+    const int samples = std::max(arcSamples, 1);
+    const int lastSample = fullCircle ? samples - 1 : samples;
+    for (int k = 0; k <= lastSample; ++k) {
+      angles.push_back(span * static_cast<float>(k) / static_cast<float>(samples));
+    }
+
+    std::sort(angles.begin(), angles.end());
+    angles.erase(std::unique(angles.begin(), angles.end(),
+      [](float a, float b) { return b - a < Constants::RAYCAST_EPSILON; }), angles.end());
+    std::sort(intervals.begin(), intervals.end(),
+      [](const Interval& a, const Interval& b) { return a.start < b.start; });
+
+    outPoints.reserve(angles.size());
+    active.clear();
+    size_t next = 0;
+    for (float angle : angles) {
+      while (next < intervals.size() && intervals[next].start <= angle + Constants::RAYCAST_EPSILON) {
+        active.push_back(next++);
+      }
+      active.erase(std::remove_if(active.begin(), active.end(),
+        [&](size_t i) { return intervals[i].end < angle - Constants::RAYCAST_EPSILON; }), active.end());
+
+      SDL_FPoint point{0.f, 0.f};
+      Project::Entities::Entity* hit = nullptr;
+      castRay(base + angle, point, hit);
+      outPoints.push_back(point);
+      if (outHits && hit && std::find(outHits->begin(), outHits->end(), hit) == outHits->end()) {
+        outHits->push_back(hit);
+      }
+    }
+  }
+
+  bool VisibilityPolygon::castRay(float angle, SDL_FPoint& outPoint, Project::Entities::Entity*& outHit) const {
+    const SDL_FPoint dir{std::cos(angle), std::sin(angle)};
+    float closest = radius;
+    outHit = nullptr;
+
+    for (size_t index : active) {
+      const OccluderSegment& segment = segments[intervals[index].segment];
+      const SDL_FPoint p{segment.a.x - origin.x, segment.a.y - origin.y};
+      const SDL_FPoint e{segment.b.x - segment.a.x, segment.b.y - segment.a.y};
+      const float denom = cross(dir, e);
+      if (std::abs(denom) < Constants::RAYCAST_EPSILON) continue;
+
+      const float t = cross(p, e) / denom;
+      const float s = cross(p, dir) / denom;
+      if (t <= 0.f || t >= closest) continue;
+      if (s < -Constants::VISIBILITY_ANGLE_EPSILON || s > Constants::DEFAULT_WHOLE + Constants::VISIBILITY_ANGLE_EPSILON) continue;
+      closest = t;
+      outHit = segment.owner;
+    }
+
+    outPoint = SDL_FPoint{origin.x + dir.x * closest, origin.y + dir.y * closest};
+    return outHit != nullptr;
+  }
+}
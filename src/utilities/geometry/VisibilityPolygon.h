@@ -0,0 +1,48 @@
+#ifndef VISIBILITY_POLYGON_H
+#define VISIBILITY_POLYGON_H
+
+#include <vector>
+
+#include <SDL.h>
+
+namespace Project::Entities { class Entity; }
+
+namespace Project::Utilities {
+  struct OccluderSegment {
+    SDL_FPoint a;
+    SDL_FPoint b;
+    Project::Entities::Entity* owner = nullptr;
+  };
+
+  class VisibilityPolygon {
+  public:
+    void begin(const SDL_FPoint& origin, float radius);
+    void addRect(const SDL_FRect& rect, Project::Entities::Entity* owner);
+    void addSegment(const SDL_FPoint& a, const SDL_FPoint& b, Project::Entities::Entity* owner);
+
+    void compute(float startDegrees, float endDegrees, int arcSamples,
+      std::vector<SDL_FPoint>& outPoints,
+      std::vector<Project::Entities::Entity*>* outHits = nullptr);
+
+    size_t getSegmentCount() const { return segments.size(); }
+
+  private:
+    struct Interval {
+      float start;
+      float end;
+      size_t segment;
+    };
+
+    SDL_FPoint origin{0.f, 0.f};
+    float radius = 0.f;
+
+    std::vector<OccluderSegment> segments;
+    std::vector<Interval> intervals;
+    std::vector<float> angles;
+    std::vector<size_t> active;
+
+    bool castRay(float angle, SDL_FPoint& outPoint, Project::Entities::Entity*& outHit) const;
+  };
+}
+
+#endif
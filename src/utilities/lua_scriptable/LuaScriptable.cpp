@@ -14,6 +14,10 @@ namespace Project::Utilities {
     }
   }
 
+  LuaScriptable::LuaScriptable(LogsManager& logsManager, std::shared_ptr<LuaStateWrapper> sharedState)
+    : logsManager(logsManager),
+      luaStateWrapper(logsManager, std::move(sharedState)) {}
+
   bool LuaScriptable::attachLuaScript(const std::string& scriptPath) {
     if (logsManager.checkAndLogError(!luaStateWrapper.isValid(), "Lua state is null")) {
       return false;
@@ -1,6 +1,7 @@
 #ifndef LUA_SCRIPTABLE_H
 #define LUA_SCRIPTABLE_H
 
+#include <memory>
 #include <string>
 
 #include "utilities/lua_state_wrapper/LuaStateWrapper.h"
@@ -10,6 +11,7 @@ namespace Project::Utilities {
   class LuaScriptable {
   public:
     explicit LuaScriptable(Project::Utilities::LogsManager& logsManager);
+    LuaScriptable(Project::Utilities::LogsManager& logsManager, std::shared_ptr<LuaStateWrapper> sharedState);
     virtual ~LuaScriptable() = default;
 
     lua_State* getLuaState() const { return luaStateWrapper.get(); }
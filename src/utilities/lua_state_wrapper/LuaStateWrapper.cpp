@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include "libraries/constants/Constants.h"
+#include "libraries/constants/ScriptConstants.h"
 #include "libraries/keys/Keys.h"
 
 namespace Project::Utilities {
@@ -22,7 +23,7 @@ namespace Project::Utilities {
   LuaStateWrapper::LuaStateWrapper(LogsManager& logsManager)
     : luaState(luaL_newstate()),
       logsManager(logsManager),
-      persistentBytecodeCache(Constants::LUA_BYTECODE_CACHE_FILE) {
+      persistentBytecodeCache(std::make_unique<BinaryFileCache>(Constants::LUA_BYTECODE_CACHE_FILE)) {
     if (logsManager.checkAndLogError(!luaState, "Failed to create Lua state")) {
       return;
     }
@@ -30,12 +31,46 @@ namespace Project::Utilities {
     registerFunction(Project::Libraries::Keys::LUA_FUNC_FAST_DISTANCE, luaFastDistance);
   }
 
+  LuaStateWrapper::LuaStateWrapper(LogsManager& logsManager, std::shared_ptr<LuaStateWrapper> host)
+    : luaState(host ? host->get() : nullptr),
+      logsManager(logsManager),
+      host(std::move(host)) {
+    if (logsManager.checkAndLogError(!luaState, "Shared Lua state is invalid")) {
+      return;
+    }
+    auto lock = lockState();
+    createEnvironment();
+  }
+
   LuaStateWrapper::~LuaStateWrapper() {
+    if (host) {
+      auto lock = lockState();
+      releaseFunctionRefs();
+      releaseEnvironment();
+      luaState = nullptr;
+      return;
+    }
+
     if (luaState) {
       lua_close(luaState);
       luaState = nullptr;
     }
-     persistentBytecodeCache.save();
+    persistentBytecodeCache->save();
+  }
+
+  void LuaStateWrapper::getScopedGlobal(lua_State* L, const char* name) {
+    lua_getfield(L, LUA_REGISTRYINDEX, Constants::LUA_ACTIVE_ENVIRONMENT);
+    int env = lua_isinteger(L, -1) ? static_cast<int>(lua_tointeger(L, -1)) : LUA_NOREF;
+    lua_pop(L, 1);
+
+    if (env == LUA_NOREF) {
+      lua_getglobal(L, name);
+      return;
+    }
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, env);
+    lua_getfield(L, -1, name);
+    lua_remove(L, -2);
   }
 
   void LuaStateWrapper::initializeSafeState(lua_State* state) {
@@ -85,6 +120,15 @@ namespace Project::Utilities {
   }
 
   void LuaStateWrapper::reset() {
+    if (host) {
+      auto lock = lockState();
+      releaseFunctionRefs();
+      releaseEnvironment();
+      registeredFunctions.clear();
+      createEnvironment();
+      return;
+    }
+
     if (luaState) {
       lua_close(luaState);
     }
@@ -97,9 +141,10 @@ namespace Project::Utilities {
 
     initializeSafeState(luaState);
     registeredFunctions.clear();
+    sharedBindings.clear();
     compiledScriptCache.clear();
     functionRefCache.clear();
-    persistentBytecodeCache.load();
+    persistentBytecodeCache->load();
   }
 
   bool LuaStateWrapper::isValid() const {
@@ -111,59 +156,75 @@ namespace Project::Utilities {
       return false;
     }
 
-    functionRefCache.clear();
-
-    auto cacheIt = compiledScriptCache.find(scriptPath);
-    int status = LUA_OK;
-    if (cacheIt != compiledScriptCache.end()) {
-      const auto& bytecode = cacheIt->second;
-      status = luaL_loadbuffer(luaState, bytecode.data(), bytecode.size(), scriptPath.c_str());
-    } else {
-      std::vector<char> bytecode;
-      if (persistentBytecodeCache.getData(scriptPath, bytecode)) {
-        compiledScriptCache[scriptPath] = bytecode;
-        status = luaL_loadbuffer(luaState, bytecode.data(), bytecode.size(), scriptPath.c_str());
-      } else {
-        status = luaL_loadfile(luaState, scriptPath.c_str());
-        if (status == LUA_OK) {
-          auto writer = [](lua_State*, const void* p, size_t sz, void* ud) -> int {
-            auto* buffer = static_cast<std::vector<char>*>(ud);
-            const char* cp = static_cast<const char*>(p);
-            buffer->insert(buffer->end(), cp, cp + sz);
-            return 0;
-          };
-
-          std::vector<char> newBytecode;
-          if (lua_dump(luaState, writer, &newBytecode, 0) == 0) {
-            compiledScriptCache[scriptPath] = newBytecode;
-            persistentBytecodeCache.setData(scriptPath, newBytecode);
-          } else {
-            logsManager.logError("Failed to dump bytecode for " + scriptPath);
-          }
-        }
-      }
-    }
+    auto lock = lockState();
+    releaseFunctionRefs();
 
+    int top = lua_gettop(luaState);
+    int status = host ? host->pushCompiledChunk(scriptPath) : pushCompiledChunk(scriptPath);
     if (status != LUA_OK) {
       handleLuaError(status);
       lua_pop(luaState, 1);
       return false;
     }
 
+    if (host) {
+      lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+      if (!lua_setupvalue(luaState, -2, 1)) lua_pop(luaState, 1);
+    }
+
+    int previous = enterEnvironment();
     status = lua_pcall(luaState, 0, LUA_MULTRET, 0);
+    leaveEnvironment(previous);
     if (status != LUA_OK) {
       handleLuaError(status);
       return false;
     }
 
+    if (host) lua_settop(luaState, top);
     return true;
   }
 
+  int LuaStateWrapper::pushCompiledChunk(const std::string& scriptPath) {
+    auto lock = lockState();
+    auto cacheIt = compiledScriptCache.find(scriptPath);
+    if (cacheIt != compiledScriptCache.end()) {
+      const auto& bytecode = cacheIt->second;
+      return luaL_loadbuffer(luaState, bytecode.data(), bytecode.size(), scriptPath.c_str());
+    }
+
+    std::vector<char> bytecode;
+    if (persistentBytecodeCache->getData(scriptPath, bytecode)) {
+      compiledScriptCache[scriptPath] = bytecode;
+      return luaL_loadbuffer(luaState, bytecode.data(), bytecode.size(), scriptPath.c_str());
+    }
+
+    int status = luaL_loadfile(luaState, scriptPath.c_str());
+    if (status == LUA_OK) {
+      auto writer = [](lua_State*, const void* p, size_t sz, void* ud) -> int {
+        auto* buffer = static_cast<std::vector<char>*>(ud);
+        const char* cp = static_cast<const char*>(p);
+        buffer->insert(buffer->end(), cp, cp + sz);
+        return 0;
+      };
+
+      std::vector<char> newBytecode;
+      if (lua_dump(luaState, writer, &newBytecode, 0) == 0) {
+        compiledScriptCache[scriptPath] = newBytecode;
+        persistentBytecodeCache->setData(scriptPath, newBytecode);
+      } else {
+        logsManager.logError("Failed to dump bytecode for " + scriptPath);
+      }
+    }
+    return status;
+  }
+
   bool LuaStateWrapper::loadScriptFromString(const std::string& code) {
     if (logsManager.checkAndLogError(!isValid(), "Lua state is invalid. Cannot load script from string.")) {
       return false;
     }
 
+    auto lock = lockState();
+    int top = lua_gettop(luaState);
     int status = luaL_loadstring(luaState, code.c_str());
     if (status != LUA_OK) {
       handleLuaError(status);
@@ -171,19 +232,28 @@ namespace Project::Utilities {
       return false;
     }
 
+    if (host) {
+      lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+      if (!lua_setupvalue(luaState, -2, 1)) lua_pop(luaState, 1);
+    }
+
+    int previous = enterEnvironment();
     status = lua_pcall(luaState, 0, LUA_MULTRET, 0);
+    leaveEnvironment(previous);
     if (status != LUA_OK) {
       handleLuaError(status);
       return false;
     }
 
+    if (host) lua_settop(luaState, top);
     return true;
   }
   
   std::string LuaStateWrapper::getGlobalString(const std::string& name, const std::string& defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     std::string result = defaultValue;
     if (lua_isstring(luaState, -1)) {
       result = lua_tostring(luaState, -1);
@@ -195,8 +265,9 @@ namespace Project::Utilities {
 
   float LuaStateWrapper::getGlobalNumber(const std::string& name, float defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
     
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     float result = defaultValue;
     if (lua_isnumber(luaState, -1)) {
       result = static_cast<float>(lua_tonumber(luaState, -1));
@@ -208,8 +279,9 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::getGlobalBoolean(const std::string& name, bool defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     bool result = defaultValue;
     if (lua_isboolean(luaState, -1)) {
       result = lua_toboolean(luaState, -1);
@@ -221,26 +293,30 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::setGlobalString(const std::string& name, const std::string& value) const {
     if (!isValid()) return;
+    auto lock = lockState();
     lua_pushstring(luaState, value.c_str());
-    lua_setglobal(luaState, name.c_str());
+    setGlobalFromTop(name);
   }
 
   void LuaStateWrapper::setGlobalNumber(const std::string& name, float value) {
     if (!isValid()) return;
+    auto lock = lockState();
     lua_pushnumber(luaState, value);
-    lua_setglobal(luaState, name.c_str());
+    setGlobalFromTop(name);
   }
 
   void LuaStateWrapper::setGlobalBoolean(const std::string& name, bool value) {
     if (!isValid()) return;
+    auto lock = lockState();
     lua_pushboolean(luaState, value);
-    lua_setglobal(luaState, name.c_str());
+    setGlobalFromTop(name);
   }
 
    std::string LuaStateWrapper::getTableString(const std::string& tableName, const std::string& key, const std::string& defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       return defaultValue;
@@ -259,8 +335,9 @@ namespace Project::Utilities {
 
   float LuaStateWrapper::getTableNumber(const std::string& tableName, const std::string& key, float defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       return defaultValue;
@@ -279,8 +356,9 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::getTableBoolean(const std::string& tableName, const std::string& key, bool defaultValue) const {
     if (!isValid()) return defaultValue;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       return defaultValue;
@@ -299,8 +377,9 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::setTableString(const std::string& tableName, const std::string& key, const std::string& value) {
     if (!isValid()) return;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       handleLuaError("Table '" + tableName + "' does not exist.");
@@ -315,8 +394,9 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::setTableNumber(const std::string& tableName, const std::string& key, float value) {
     if (!isValid()) return;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       handleLuaError("Table '" + tableName + "' does not exist.");
@@ -331,8 +411,9 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::setTableBoolean(const std::string& tableName, const std::string& key, bool value) {
     if (!isValid()) return;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, tableName.c_str());
+    pushGlobal(tableName);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       handleLuaError("Table '" + tableName + "' does not exist.");
@@ -347,8 +428,9 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::isGlobalFunction(const std::string& name) const {
     if (!isValid()) return false;
+    auto lock = lockState();
     
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     bool isFunc = lua_isfunction(luaState, -1);
     lua_pop(luaState, 1);
     return isFunc;
@@ -356,14 +438,18 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::callGlobalFunction(const std::string& name, int nargs, int nresults) const {
     if (!isValid()) return false;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     if (!lua_isfunction(luaState, -1)) {
       lua_pop(luaState, 1);
       return false;
     }
 
-    if (lua_pcall(luaState, nargs, nresults, 0) != LUA_OK) {
+    int previous = enterEnvironment();
+    int status = lua_pcall(luaState, nargs, nresults, 0);
+    leaveEnvironment(previous);
+    if (status != LUA_OK) {
       const char* error = lua_tostring(luaState, -1);
       handleLuaError(std::string("Lua function call failed: ") + (error ? error : "Unknown error"));
       return false;
@@ -374,14 +460,18 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::callFunctionIfExists(const std::string& name) {
     if (!isValid()) return false;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     if (!lua_isfunction(luaState, -1)) {
       lua_pop(luaState, 1);
       return false;
     }
 
-    if (lua_pcall(luaState, 0, 0, 0) != LUA_OK) {
+    int previous = enterEnvironment();
+    int status = lua_pcall(luaState, 0, 0, 0);
+    leaveEnvironment(previous);
+    if (status != LUA_OK) {
       handleLuaError("Error calling Lua function '" + name + "': " + std::string(lua_tostring(luaState, -1)));
       return false;
     }
@@ -391,7 +481,8 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::isGlobalTable(const std::string& name) const {
     if (!isValid()) return false;
-    lua_getglobal(luaState, name.c_str());
+    auto lock = lockState();
+    pushGlobal(name);
     bool isTable = lua_istable(luaState, -1);
     lua_pop(luaState, 1);
     return isTable;
@@ -399,8 +490,9 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::iterateGlobalTable(const std::string& name, std::function<void(lua_State*, int)> callback) const {
     if (!isValid()) return;
+    auto lock = lockState();
 
-    lua_getglobal(luaState, name.c_str());
+    pushGlobal(name);
     if (!lua_istable(luaState, -1)) {
       lua_pop(luaState, 1);
       return;
@@ -430,6 +522,7 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::printStack() const {
     if (!isValid()) return;
+    auto lock = lockState();
 
     int top = lua_gettop(luaState);
     logsManager.logMessage("Lua Stack (Top: " + std::to_string(top) + "):");
@@ -465,14 +558,65 @@ namespace Project::Utilities {
     }
   }
 
+  bool LuaStateWrapper::callFunctionIfExists(const std::string& name, const std::vector<std::string>& values) {
+    if (!isValid()) return false;
+    auto lock = lockState();
+
+    pushGlobal(name);
+    if (!lua_isfunction(luaState, -1)) {
+      lua_pop(luaState, 1);
+      return false;
+    }
+
+    lua_createtable(luaState, static_cast<int>(values.size()), 0);
+    for (size_t i = 0; i < values.size(); ++i) {
+      lua_pushstring(luaState, values[i].c_str());
+      lua_rawseti(luaState, -2, static_cast<lua_Integer>(i + 1));
+    }
+
+    int previous = enterEnvironment();
+    int status = lua_pcall(luaState, 1, 0, 0);
+    leaveEnvironment(previous);
+    if (status != LUA_OK) {
+      handleLuaError("Error calling Lua function '" + name + "': " + std::string(lua_tostring(luaState, -1)));
+      return false;
+    }
+
+    return true;
+  }
+
+  bool LuaStateWrapper::hasScopedFunctions() const {
+    if (!isValid()) return false;
+    if (environmentRef == LUA_NOREF) return true;
+
+    auto lock = lockState();
+    lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+    lua_pushnil(luaState);
+    while (lua_next(luaState, -2)) {
+      bool scripted = lua_isfunction(luaState, -1) && !lua_iscfunction(luaState, -1);
+      lua_pop(luaState, 1);
+      if (scripted) {
+        lua_pop(luaState, 2);
+        return true;
+      }
+    }
+    lua_pop(luaState, 1);
+    return false;
+  }
+
   void LuaStateWrapper::registerFunction(const std::string& name, lua_CFunction function) {
     if (!isValid()) return;
+    auto lock = lockState();
     if (registeredFunctions.count(name)) {
       return;
     }
+    if (host && registerSharedBinding(name, function, nullptr)) {
+      return;
+    }
 
 
-    lua_register(luaState, name.c_str(), function);
+    lua_pushcfunction(luaState, function);
+    setGlobalFromTop(name);
     if (lua_gettop(luaState) > 0 && lua_isstring(luaState, -1)) {
       const char* errorMessage = lua_tostring(luaState, -1);
       logsManager.logError("Failed to register Lua function '" + name + "': " + std::string(errorMessage));
@@ -484,13 +628,17 @@ namespace Project::Utilities {
 
   void LuaStateWrapper::registerFunction(const std::string& name, lua_CFunction function, void* userData) {
     if (!isValid()) return;
+    auto lock = lockState();
     if (registeredFunctions.count(name)) {
       return;
     }
+    if (host && registerSharedBinding(name, function, userData)) {
+      return;
+    }
 
     lua_pushlightuserdata(luaState, userData);
     lua_pushcclosure(luaState, function, 1);
-    lua_setglobal(luaState, name.c_str());
+    setGlobalFromTop(name);
 
     if (lua_gettop(luaState) > 0 && lua_isstring(luaState, -1)) {
       const char* errorMessage = lua_tostring(luaState, -1);
@@ -503,10 +651,11 @@ namespace Project::Utilities {
 
   bool LuaStateWrapper::callCachedFunction(const std::string& name, int nargs, int nresults) {
     if (!isValid()) return false;
+    auto lock = lockState();
 
     auto it = functionRefCache.find(name);
     if (it == functionRefCache.end()) {
-      lua_getglobal(luaState, name.c_str());
+      pushGlobal(name);
       if (!lua_isfunction(luaState, -1)) {
         lua_pop(luaState, 1);
         return false;
@@ -516,7 +665,10 @@ namespace Project::Utilities {
     }
 
     lua_rawgeti(luaState, LUA_REGISTRYINDEX, it->second);
-    if (lua_pcall(luaState, nargs, nresults, 0) != LUA_OK) {
+    int previous = enterEnvironment();
+    int status = lua_pcall(luaState, nargs, nresults, 0);
+    leaveEnvironment(previous);
+    if (status != LUA_OK) {
       handleLuaError(std::string("Lua function call failed: ") + std::string(lua_tostring(luaState, -1)));
       return false;
     }
@@ -558,4 +710,97 @@ namespace Project::Utilities {
     logsManager.logLuaMessage(logMessage);
     logsManager.logError(logMessage);
   }
+
+  std::unique_lock<std::recursive_mutex> LuaStateWrapper::lockState() const {
+    if (!host) return std::unique_lock<std::recursive_mutex>();
+    return std::unique_lock<std::recursive_mutex>(host->stateMutex);
+  }
+
+  void LuaStateWrapper::createEnvironment() {
+    lua_newtable(luaState);
+    if (luaL_newmetatable(luaState, Constants::LUA_ENVIRONMENT_META)) {
+      lua_newtable(luaState);
+      lua_createtable(luaState, 0, 1);
+      lua_pushglobaltable(luaState);
+      lua_setfield(luaState, -2, "__index");
+      lua_setmetatable(luaState, -2);
+      lua_pushvalue(luaState, -1);
+      lua_setfield(luaState, LUA_REGISTRYINDEX, Constants::LUA_SHARED_BINDINGS);
+      lua_setfield(luaState, -2, "__index");
+    }
+    lua_setmetatable(luaState, -2);
+    environmentRef = luaL_ref(luaState, LUA_REGISTRYINDEX);
+  }
+
+  bool LuaStateWrapper::registerSharedBinding(const std::string& name, lua_CFunction function, void* userData) {
+    auto [it, inserted] = host->sharedBindings.emplace(name, userData);
+    if (!inserted) return it->second == userData;
+
+    lua_getfield(luaState, LUA_REGISTRYINDEX, Constants::LUA_SHARED_BINDINGS);
+    if (userData) {
+      lua_pushlightuserdata(luaState, userData);
+      lua_pushcclosure(luaState, function, 1);
+    } else {
+      lua_pushcfunction(luaState, function);
+    }
+    lua_setfield(luaState, -2, name.c_str());
+    lua_pop(luaState, 1);
+    return true;
+  }
+
+  void LuaStateWrapper::releaseEnvironment() {
+    if (environmentRef == LUA_NOREF) return;
+    luaL_unref(luaState, LUA_REGISTRYINDEX, environmentRef);
+    environmentRef = LUA_NOREF;
+  }
+
+  void LuaStateWrapper::releaseFunctionRefs() {
+    if (host && luaState) {
+      for (const auto& [name, ref] : functionRefCache) {
+        luaL_unref(luaState, LUA_REGISTRYINDEX, ref);
+      }
+    }
+    functionRefCache.clear();
+  }
+
+  void LuaStateWrapper::pushGlobal(const std::string& name) const {
+    if (environmentRef == LUA_NOREF) {
+      lua_getglobal(luaState, name.c_str());
+      return;
+    }
+    lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+    lua_getfield(luaState, -1, name.c_str());
+    lua_remove(luaState, -2);
+  }
+
+  void LuaStateWrapper::setGlobalFromTop(const std::string& name) const {
+    if (environmentRef == LUA_NOREF) {
+      lua_setglobal(luaState, name.c_str());
+      return;
+    }
+    lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+    lua_insert(luaState, -2);
+    lua_setfield(luaState, -2, name.c_str());
+    lua_pop(luaState, 1);
+  }
+
+  int LuaStateWrapper::enterEnvironment() const {
+    if (environmentRef == LUA_NOREF) return LUA_NOREF;
+    lua_getfield(luaState, LUA_REGISTRYINDEX, Constants::LUA_ACTIVE_ENVIRONMENT);
+    int previous = lua_isinteger(luaState, -1) ? static_cast<int>(lua_tointeger(luaState, -1)) : LUA_NOREF;
+    lua_pop(luaState, 1);
+    lua_pushinteger(luaState, environmentRef);
+    lua_setfield(luaState, LUA_REGISTRYINDEX, Constants::LUA_ACTIVE_ENVIRONMENT);
+    return previous;
+  }
+
+  void LuaStateWrapper::leaveEnvironment(int previous) const {
+    if (environmentRef == LUA_NOREF) return;
+    if (previous == LUA_NOREF) {
+      lua_pushnil(luaState);
+    } else {
+      lua_pushinteger(luaState, previous);
+    }
+    lua_setfield(luaState, LUA_REGISTRYINDEX, Constants::LUA_ACTIVE_ENVIRONMENT);
+  }
 }
@@ -3,6 +3,8 @@
 
 #include <lua.hpp>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <optional>
 #include <vector>
@@ -17,16 +19,19 @@ namespace Project::Utilities {
   class LuaStateWrapper : public Project::Interfaces::Resetable {
   public:
     LuaStateWrapper(LogsManager& logsManager);
+    LuaStateWrapper(LogsManager& logsManager, std::shared_ptr<LuaStateWrapper> host);
     ~LuaStateWrapper();
 
     static void initializeSafeState(lua_State* state);
+    static void getScopedGlobal(lua_State* L, const char* name);
 
     // Generic argument-based function call
     template<typename... Args>
     bool callGlobalFunctionWithArgs(const std::string& name, int nresults, Args... args) {
       if (!luaState) return false;
 
-      lua_getglobal(luaState, name.c_str());
+      auto lock = lockState();
+      pushGlobal(name);
       if (!lua_isfunction(luaState, -1)) {
         lua_pop(luaState, 1); 
         logsManager.logError("Lua: '" + name + "' is not a function.");
@@ -52,7 +57,9 @@ namespace Project::Utilities {
 
       (push(args), ...);
       int argCount = sizeof...(Args);
+      int previous = enterEnvironment();
       int result = lua_pcall(luaState, argCount, nresults, 0);
+      leaveEnvironment(previous);
       if (result != LUA_OK) {
         handleLuaError(result);
         return false;
@@ -65,6 +72,7 @@ namespace Project::Utilities {
     void reset();
     
     bool isValid() const;
+    bool isShared() const { return host != nullptr; }
     bool loadScript(const std::string& scriptPath);
     bool loadScriptFromString(const std::string& code); 
 
@@ -92,6 +100,8 @@ namespace Project::Utilities {
     bool isGlobalFunction(const std::string& name) const;
     bool callGlobalFunction(const std::string& name, int nargs = 0, int nresults = 0) const;
     bool callFunctionIfExists(const std::string& name);
+    bool callFunctionIfExists(const std::string& name, const std::vector<std::string>& values);
+    bool hasScopedFunctions() const;
 
     // Table handling
     bool isGlobalTable(const std::string& name) const;
@@ -111,11 +121,30 @@ namespace Project::Utilities {
   private:
     lua_State* luaState;
     LogsManager& logsManager;
-    BinaryFileCache persistentBytecodeCache;
+    std::unique_ptr<BinaryFileCache> persistentBytecodeCache;
+
+    // Wrappers sharing a host lock the host's mutex for every VM access. EntitiesManager
+    // already runs all entities of one shared VM on a single lane, so the lock is only
+    // contended by cross-lane callers; it is recursive because bindings re-enter the wrapper.
+    std::shared_ptr<LuaStateWrapper> host;
+    int environmentRef = LUA_NOREF;
+    mutable std::recursive_mutex stateMutex;
+    std::unordered_map<std::string, void*> sharedBindings;
 
     std::unordered_map<std::string, std::vector<char>> compiledScriptCache;
     std::unordered_map<std::string, int> functionRefCache;
     std::unordered_set<std::string> registeredFunctions;
+
+    std::unique_lock<std::recursive_mutex> lockState() const;
+    int pushCompiledChunk(const std::string& scriptPath);
+    void createEnvironment();
+    bool registerSharedBinding(const std::string& name, lua_CFunction function, void* userData);
+    void releaseEnvironment();
+    void releaseFunctionRefs();
+    void pushGlobal(const std::string& name) const;
+    void setGlobalFromTop(const std::string& name) const;
+    int enterEnvironment() const;
+    void leaveEnvironment(int previous) const;
   };
 }
 
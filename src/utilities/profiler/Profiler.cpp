@@ -1,50 +1,234 @@
 #include "Profiler.h"
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <thread>
+
 #include "libraries/constants/FloatConstants.h"
+#include "libraries/constants/NumericConstants.h"
+#include "libraries/constants/ProfileConstants.h"
 
 namespace Project::Utilities {
   namespace Constant = Project::Libraries::Constants;
 
+  static constexpr double NANOSECONDS_PER_MICROSECOND = 1000.0;
+  static constexpr double NANOSECONDS_PER_MILLISECOND = 1000000.0;
+  static_assert((Constant::PROFILER_RING_CAPACITY & (Constant::PROFILER_RING_CAPACITY - 1)) == 0, "Profiler ring capacity must be a power of two");
+
+  static void writeJsonString(std::ostream& out, const char* value) {
+    out << '"';
+    for (const char* c = value ? value : ""; *c; ++c) {
+      switch (*c) {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(*c) < 0x20) out << ' ';
+          else out << *c;
+      }
+    }
+    out << '"';
+  }
+
   Profiler& Profiler::getInstance() {
     static Profiler instance;
     return instance;
   }
 
+  Profiler::Profiler() : epoch(Clock::now()) {}
+
   void Profiler::beginFrame() {
-    times.clear();
-    gpuTimes.clear();
-    drawCalls = 0;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      times.clear();
+      gpuTimes.clear();
+    }
+    drawCalls.store(0, std::memory_order_relaxed);
+    const std::uint32_t frame = frameIndex.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!isEnabled()) return;
+    ProfileEvent marker;
+    marker.name = Constant::FRAME_MARKER;
+    marker.start = toNanoseconds(Clock::now());
+    marker.frame = frame;
+    marker.type = ProfileEventType::FRAME;
+    record(getThreadBuffer(), marker);
   }
 
   void Profiler::addTime(const std::string& name, double ms) {
+    std::lock_guard<std::mutex> lock(statsMutex);
     times[name] += ms;
   }
 
   void Profiler::addGPUTime(const std::string& name, double ms) {
+    std::lock_guard<std::mutex> lock(statsMutex);
     gpuTimes[name] += ms;
   }
 
   void Profiler::incrementDrawCalls(int count) {
-    drawCalls += count;
+    drawCalls.fetch_add(count, std::memory_order_relaxed);
   }
 
   void Profiler::setMemoryUsage(const std::string& name, std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(statsMutex);
     memory[name] = bytes;
   }
 
+  bool Profiler::pushScope(std::uint16_t& depth) {
+    ThreadBuffer& buffer = getThreadBuffer();
+    buffer.openScopes.fetch_add(1, std::memory_order_seq_cst);
+    if (!enabled.load(std::memory_order_seq_cst)) {
+      buffer.openScopes.fetch_sub(1, std::memory_order_relaxed);
+      return false;
+    }
+    depth = buffer.depth++;
+    return true;
+  }
+
+  void Profiler::popScope(const char* name, ProfileEventType type, Clock::time_point start, Clock::time_point end, std::uint16_t depth) {
+    ThreadBuffer& buffer = getThreadBuffer();
+    buffer.depth = depth;
+
+    ProfileEvent event;
+    event.name = name;
+    event.start = toNanoseconds(start);
+    event.duration = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    event.frame = frameIndex.load(std::memory_order_relaxed);
+    event.depth = depth;
+    event.type = type;
+    record(buffer, event);
+    accumulate(buffer, event);
+    buffer.openScopes.fetch_sub(1, std::memory_order_release);
+  }
+
+  void Profiler::accumulate(ThreadBuffer& buffer, const ProfileEvent& event) {
+    const bool gpu = event.type == ProfileEventType::GPU;
+    const std::size_t mask = buffer.totals.size() - 1;
+    std::size_t slot = static_cast<std::size_t>(std::hash<const char*>{}(event.name)) & mask;
+    for (std::size_t probe = 0; probe < buffer.totals.size(); ++probe, slot = (slot + 1) & mask) {
+      ScopeTotal& total = buffer.totals[slot];
+      const char* name = total.name.load(std::memory_order_relaxed);
+      if (!name) {
+        total.gpu = gpu;
+        total.nanoseconds.store(event.duration, std::memory_order_relaxed);
+        total.frame.store(event.frame, std::memory_order_relaxed);
+        total.name.store(event.name, std::memory_order_release);
+        return;
+      }
+      if (name != event.name || total.gpu != gpu) continue;
+
+      // Only the owning thread writes a slot, so a load and store stand in for an atomic add.
+      const bool sameFrame = total.frame.load(std::memory_order_relaxed) == event.frame;
+      const std::uint64_t base = sameFrame ? total.nanoseconds.load(std::memory_order_relaxed) : 0;
+      total.nanoseconds.store(base + event.duration, std::memory_order_relaxed);
+      total.frame.store(event.frame, std::memory_order_release);
+      return;
+    }
+  }
+
+  template <typename F>
+  void Profiler::forEachScopeTime(bool gpu, F&& callback) const {
+    const std::uint32_t frame = frameIndex.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (const auto& buffer : threadBuffers) {
+      for (const ScopeTotal& total : buffer->totals) {
+        const char* name = total.name.load(std::memory_order_acquire);
+        if (!name || total.gpu != gpu) continue;
+        if (total.frame.load(std::memory_order_acquire) != frame) continue;
+        callback(name, static_cast<double>(total.nanoseconds.load(std::memory_order_relaxed)) / NANOSECONDS_PER_MILLISECOND);
+      }
+    }
+  }
+
+  bool Profiler::exportChromeTrace(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    // Rings are written without locks, so stop new scopes and let open ones on other threads publish first.
+    const ThreadBuffer* self = &getThreadBuffer();
+    const bool wasEnabled = enabled.exchange(false, std::memory_order_seq_cst);
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (const auto& buffer : threadBuffers) {
+      if (buffer.get() == self) continue;
+      while (buffer->openScopes.load(std::memory_order_seq_cst) != 0) std::this_thread::yield();
+    }
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&]() {
+      if (!first) out << ',';
+      first = false;
+    };
+
+    for (const auto& buffer : threadBuffers) {
+      separator();
+      const std::string threadName = Constant::TRACE_THREAD_PREFIX + std::to_string(buffer->threadId);
+      out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+      writeJsonString(out, threadName.c_str());
+      out << "}}";
+
+      const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+      const std::uint64_t capacity = buffer->events.size();
+      const std::uint64_t count = std::min(head, capacity);
+      for (std::uint64_t i = head - count; i < head; ++i) {
+        const ProfileEvent& event = buffer->events[i & (capacity - 1)];
+        separator();
+        out << "{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"pid\":1,\"tid\":" << buffer->threadId
+            << ",\"ts\":" << static_cast<double>(event.start) / NANOSECONDS_PER_MICROSECOND;
+        if (event.type == ProfileEventType::FRAME) {
+          out << ",\"ph\":\"i\",\"s\":\"g\"";
+        } else {
+          out << ",\"ph\":\"X\",\"cat\":";
+          writeJsonString(out, event.type == ProfileEventType::GPU ? Constant::TRACE_GPU_CATEGORY : Constant::TRACE_CPU_CATEGORY);
+          out << ",\"dur\":" << static_cast<double>(event.duration) / NANOSECONDS_PER_MICROSECOND;
+        }
+        out << ",\"args\":{\"frame\":" << event.frame << ",\"depth\":" << event.depth << "}}";
+      }
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}";
+    enabled.store(wasEnabled, std::memory_order_seq_cst);
+    return static_cast<bool>(out);
+  }
+
   double Profiler::getTime(const std::string& name) const {
-    auto it = times.find(name);
-    return it != times.end() ? it->second : 0.0;
+    double total = 0.0;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      auto it = times.find(name);
+      if (it != times.end()) total = it->second;
+    }
+    forEachScopeTime(false, [&](const char* scope, double ms) {
+      if (name == scope) total += ms;
+    });
+    return total;
   }
 
   double Profiler::getGPUTime(const std::string& name) const {
-    auto it = gpuTimes.find(name);
-    return it != gpuTimes.end() ? it->second : 0.0;
+    double total = 0.0;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      auto it = gpuTimes.find(name);
+      if (it != gpuTimes.end()) total = it->second;
+    }
+    forEachScopeTime(true, [&](const char* scope, double ms) {
+      if (name == scope) total += ms;
+    });
+    return total;
   }
 
   double Profiler::getTotalGPUTime() const {
     double total = 0.0;
-    for (const auto& [k, v] : gpuTimes) total += v;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      for (const auto& [k, v] : gpuTimes) total += v;
+    }
+    forEachScopeTime(true, [&](const char*, double ms) { total += ms; });
     return total;
   }
 
@@ -56,37 +240,67 @@ namespace Project::Utilities {
   }
 
   int Profiler::getDrawCalls() const {
-    return drawCalls;
+    return drawCalls.load(std::memory_order_relaxed);
   }
 
-  const std::unordered_map<std::string, double>& Profiler::getTimes() const {
-    return times;
+  std::unordered_map<std::string, double> Profiler::getTimes() const {
+    std::unordered_map<std::string, double> merged;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      merged = times;
+    }
+    forEachScopeTime(false, [&](const char* scope, double ms) { merged[scope] += ms; });
+    return merged;
   }
 
-  const std::unordered_map<std::string, double>& Profiler::getGPUTimes() const {
-    return gpuTimes;
+  std::unordered_map<std::string, double> Profiler::getGPUTimes() const {
+    std::unordered_map<std::string, double> merged;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      merged = gpuTimes;
+    }
+    forEachScopeTime(true, [&](const char* scope, double ms) { merged[scope] += ms; });
+    return merged;
   }
 
   std::size_t Profiler::getMemoryUsage(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(statsMutex);
     auto it = memory.find(name);
     return it != memory.end() ? it->second : 0u;
   }
 
-  ScopeTimer::ScopeTimer(const std::string& name)
-    : name(name), start(std::chrono::high_resolution_clock::now()) {}
+  Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+    thread_local ThreadBuffer* local = nullptr;
+    if (local) return *local;
 
-  ScopeTimer::~ScopeTimer() {
-    auto end = std::chrono::high_resolution_clock::now();
-    double ms = std::chrono::duration<double, std::milli>(end - start).count();
-    Profiler::getInstance().addTime(name, ms);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->events.resize(Constant::PROFILER_RING_CAPACITY);
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    buffer->threadId = static_cast<std::uint32_t>(threadBuffers.size());
+    local = buffer.get();
+    threadBuffers.push_back(std::move(buffer));
+    return *local;
+  }
+
+  void Profiler::record(ThreadBuffer& buffer, const ProfileEvent& event) {
+    const std::uint64_t slot = buffer.head.load(std::memory_order_relaxed);
+    buffer.events[slot & (buffer.events.size() - 1)] = event;
+    buffer.head.store(slot + 1, std::memory_order_release);
   }
 
-  GPUScopeTimer::GPUScopeTimer(const std::string& name)
-    : name(name), start(std::chrono::high_resolution_clock::now()) {}
+  std::uint64_t Profiler::toNanoseconds(Clock::time_point time) const {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch).count());
+  }
+
+  ScopeTimer::ScopeTimer(const char* name, ProfileEventType type)
+    : name(name), type(type) {
+    if (!Profiler::getInstance().isEnabled()) return;
+    active = Profiler::getInstance().pushScope(depth);
+    if (active) start = Profiler::Clock::now();
+  }
 
-  GPUScopeTimer::~GPUScopeTimer() {
-    auto end = std::chrono::high_resolution_clock::now();
-    double ms = std::chrono::duration<double, std::milli>(end - start).count();
-    Profiler::getInstance().addGPUTime(name, ms);
+  ScopeTimer::~ScopeTimer() {
+    if (!active) return;
+    Profiler::getInstance().popScope(name, type, start, Profiler::Clock::now(), depth);
   }
 }
@@ -1,58 +1,124 @@
 #ifndef PROFILER_H
 #define PROFILER_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "libraries/constants/NumericConstants.h"
 
 namespace Project::Utilities {
+  enum class ProfileEventType : std::uint8_t {
+    CPU,
+    GPU,
+    FRAME
+  };
+
+  struct ProfileEvent {
+    const char* name = nullptr;
+    std::uint64_t start = 0;
+    std::uint64_t duration = 0;
+    std::uint32_t frame = 0;
+    std::uint16_t depth = 0;
+    ProfileEventType type = ProfileEventType::CPU;
+  };
+
   class Profiler {
   public:
+    using Clock = std::chrono::steady_clock;
+
     static Profiler& getInstance();
 
+    void setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
     void beginFrame();
     void addTime(const std::string& name, double ms);
     void addGPUTime(const std::string& name, double ms);
     void incrementDrawCalls(int count = 1);
     void setMemoryUsage(const std::string& name, std::size_t bytes);
 
+    bool pushScope(std::uint16_t& depth);
+    void popScope(const char* name, ProfileEventType type, Clock::time_point start, Clock::time_point end, std::uint16_t depth);
+    bool exportChromeTrace(const std::string& path);
+
     double getTime(const std::string& name) const;
     double getGPUTime(const std::string& name) const;
     double getTotalGPUTime() const;
     double getGPUOccupancy(double frameMs) const;
 
     int getDrawCalls() const;
-    const std::unordered_map<std::string, double>& getTimes() const;
-    const std::unordered_map<std::string, double>& getGPUTimes() const;
+    std::uint32_t getFrameIndex() const { return frameIndex.load(std::memory_order_relaxed); }
+    std::unordered_map<std::string, double> getTimes() const;
+    std::unordered_map<std::string, double> getGPUTimes() const;
     std::size_t getMemoryUsage(const std::string& name) const;
 
   private:
+    struct ScopeTotal {
+      std::atomic<const char*> name{nullptr};
+      std::atomic<std::uint64_t> nanoseconds{0};
+      std::atomic<std::uint32_t> frame{0};
+      bool gpu = false;
+    };
+
+    struct ThreadBuffer {
+      std::vector<ProfileEvent> events;
+      std::atomic<std::uint64_t> head{0};
+      std::uint32_t threadId = 0;
+      std::uint16_t depth = 0;
+      std::atomic<std::uint32_t> openScopes{0};
+      std::array<ScopeTotal, Project::Libraries::Constants::PROFILER_SCOPE_SLOTS> totals;
+    };
+
+    Profiler();
+
     std::unordered_map<std::string, double> times;
     std::unordered_map<std::string, std::size_t> memory;
     std::unordered_map<std::string, double> gpuTimes;
-    int drawCalls = 0;
+    std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+
+    mutable std::mutex statsMutex;
+    mutable std::mutex buffersMutex;
+
+    Clock::time_point epoch;
+    std::atomic<std::uint32_t> frameIndex{0};
+    std::atomic<int> drawCalls{0};
+    std::atomic<bool> enabled{false};
+
+    ThreadBuffer& getThreadBuffer();
+    void accumulate(ThreadBuffer& buffer, const ProfileEvent& event);
+    template <typename F>
+    void forEachScopeTime(bool gpu, F&& callback) const;
+    void record(ThreadBuffer& buffer, const ProfileEvent& event);
+    std::uint64_t toNanoseconds(Clock::time_point time) const;
   };
 
   class ScopeTimer {
   public:
-    explicit ScopeTimer(const std::string& name);
+    explicit ScopeTimer(const char* name, ProfileEventType type = ProfileEventType::CPU);
     ~ScopeTimer();
 
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
   private:
-    std::string name;
-    std::chrono::high_resolution_clock::time_point start;
+    const char* name;
+    Profiler::Clock::time_point start;
+    ProfileEventType type;
+    std::uint16_t depth = 0;
+    bool active = false;
   };
 
-  class GPUScopeTimer {
+  class GPUScopeTimer : public ScopeTimer {
   public:
-    explicit GPUScopeTimer(const std::string& name);
-    ~GPUScopeTimer();
-
-  private:
-    std::string name;
-    std::chrono::high_resolution_clock::time_point start;
+    explicit GPUScopeTimer(const char* name) : ScopeTimer(name, ProfileEventType::GPU) {}
   };
 }
 
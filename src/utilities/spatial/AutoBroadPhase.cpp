@@ -0,0 +1,99 @@
+#include "AutoBroadPhase.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  AutoBroadPhase::AutoBroadPhase() {
+    candidates.push_back(BroadPhase::create(BroadPhaseType::BVH));
+    candidates.push_back(BroadPhase::create(BroadPhaseType::GRID));
+    candidates.push_back(BroadPhase::create(BroadPhaseType::QUAD_TREE));
+    candidates.push_back(BroadPhase::create(BroadPhaseType::SWEEP_AND_PRUNE));
+    costs.assign(candidates.size(), 0.0f);
+  }
+
+  void AutoBroadPhase::build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) {
+    if (sampling) {
+      costs[active] += frameBuildMs + frameQueryMs + frameCollectMs;
+      sampling = false;
+    }
+
+    if (!calibrating && shouldRecalibrate(proxies.size())) {
+      beginCalibration();
+    }
+
+    if (calibrating) {
+      const size_t framesPerCandidate = Constants::BROAD_PHASE_CALIBRATION_WARMUP + Constants::BROAD_PHASE_CALIBRATION_ROUNDS;
+      if (sampleFrames >= candidates.size() * framesPerCandidate) {
+        selectFastest();
+        calibratedCount = proxies.size();
+      } else {
+        active = sampleFrames / framesPerCandidate;
+        sampling = sampleFrames % framesPerCandidate >= Constants::BROAD_PHASE_CALIBRATION_WARMUP;
+        ++sampleFrames;
+      }
+    }
+
+    frameQueryMs = 0.0f;
+    frameCollectMs = 0.0f;
+    auto start = std::chrono::high_resolution_clock::now();
+    candidates[active]->build(proxies, worldBounds);
+    frameBuildMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+  }
+
+  void AutoBroadPhase::query(const SDL_FRect& area, const QueryCallback& callback) const {
+    if (!sampling) {
+      candidates[active]->query(area, callback);
+      return;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    candidates[active]->query(area, callback);
+    frameQueryMs += std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+  }
+
+  bool AutoBroadPhase::collectPairs(std::vector<ColliderPair>& pairs) const {
+    if (!sampling) {
+      return candidates[active]->collectPairs(pairs);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    bool collected = candidates[active]->collectPairs(pairs);
+    frameCollectMs += std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    return collected;
+  }
+
+  void AutoBroadPhase::clear() {
+    for (auto& candidate : candidates) {
+      candidate->clear();
+    }
+    beginCalibration();
+  }
+
+  void AutoBroadPhase::beginCalibration() {
+    std::fill(costs.begin(), costs.end(), 0.0f);
+    sampleFrames = 0;
+    sampling = false;
+    calibrating = true;
+  }
+
+  void AutoBroadPhase::selectFastest() {
+    active = static_cast<size_t>(std::distance(costs.begin(), std::min_element(costs.begin(), costs.end())));
+    calibrating = false;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (i != active) candidates[i]->clear();
+    }
+  }
+
+  bool AutoBroadPhase::shouldRecalibrate(size_t proxyCount) const {
+    float current = static_cast<float>(proxyCount);
+    float calibrated = static_cast<float>(std::max(calibratedCount, Constants::BROAD_PHASE_MIN_RECALIBRATE_COUNT));
+    return current > calibrated * Constants::BROAD_PHASE_RECALIBRATE_RATIO
+      || current * Constants::BROAD_PHASE_RECALIBRATE_RATIO < calibrated;
+  }
+}
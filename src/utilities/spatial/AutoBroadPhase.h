@@ -0,0 +1,47 @@
+#ifndef AUTO_BROAD_PHASE_H
+#define AUTO_BROAD_PHASE_H
+
+#include "BroadPhase.h"
+
+#include <memory>
+#include <vector>
+
+namespace Project::Utilities {
+  class AutoBroadPhase : public BroadPhase {
+  public:
+    using BroadPhase::query;
+
+    AutoBroadPhase();
+
+    BroadPhaseType getType() const override { return BroadPhaseType::AUTO; }
+    void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) override;
+    void query(const SDL_FRect& area, const QueryCallback& callback) const override;
+    void clear() override;
+
+    bool tracksPairs() const override { return candidates[active]->tracksPairs(); }
+    bool collectPairs(std::vector<ColliderPair>& pairs) const override;
+    const std::vector<ColliderPair>& getAddedPairs() const override { return candidates[active]->getAddedPairs(); }
+    const std::vector<ColliderPair>& getRemovedPairs() const override { return candidates[active]->getRemovedPairs(); }
+
+    BroadPhaseType getActiveType() const { return candidates[active]->getType(); }
+    bool isCalibrating() const { return calibrating; }
+
+  private:
+    std::vector<std::unique_ptr<BroadPhase>> candidates;
+    std::vector<float> costs;
+    size_t active = 0;
+    size_t sampleFrames = 0;
+    size_t calibratedCount = 0;
+    bool calibrating = true;
+    bool sampling = false;
+    float frameBuildMs = 0.0f;
+    mutable float frameQueryMs = 0.0f;
+    mutable float frameCollectMs = 0.0f;
+
+    void beginCalibration();
+    void selectFastest();
+    bool shouldRecalibrate(size_t proxyCount) const;
+  };
+}
+
+#endif
@@ -1,72 +1,423 @@
 #include "BVH.h"
 
-#include "libraries/constants/IndexConstants.h"
-
 #include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "libraries/constants/Constants.h"
 
 namespace Project::Utilities {
-  using ObjPair = std::pair<SDL_FRect, Collider>;
+  namespace Constants = Project::Libraries::Constants;
+
+  namespace {
+    SDL_FRect unionRect(const SDL_FRect& a, const SDL_FRect& b) {
+      const float left = std::min(a.x, b.x);
+      const float top = std::min(a.y, b.y);
+      const float right = std::max(a.x + a.w, b.x + b.w);
+      const float bottom = std::max(a.y + a.h, b.y + b.h);
+      return SDL_FRect{left, top, right - left, bottom - top};
+    }
+
+    float perimeter(const SDL_FRect& r) {
+      return Constants::DEFAULT_DOUBLE * (r.w + r.h);
+    }
+
+    bool contains(const SDL_FRect& outer, const SDL_FRect& inner) {
+      return outer.x <= inner.x && outer.y <= inner.y &&
+        outer.x + outer.w >= inner.x + inner.w &&
+        outer.y + outer.h >= inner.y + inner.h;
+    }
+
+    SDL_FRect fatten(const SDL_FRect& bounds, const SDL_FPoint& displacement) {
+      SDL_FRect fat{
+        bounds.x - Constants::BVH_FAT_MARGIN,
+        bounds.y - Constants::BVH_FAT_MARGIN,
+        bounds.w + Constants::BVH_FAT_MARGIN * Constants::DEFAULT_DOUBLE,
+        bounds.h + Constants::BVH_FAT_MARGIN * Constants::DEFAULT_DOUBLE
+      };
+      const float dx = displacement.x * Constants::BVH_DISPLACEMENT_MULTIPLIER;
+      const float dy = displacement.y * Constants::BVH_DISPLACEMENT_MULTIPLIER;
+      if (dx < 0.f) fat.x += dx;
+      fat.w += std::abs(dx);
+      if (dy < 0.f) fat.y += dy;
+      fat.h += std::abs(dy);
+      return fat;
+    }
+
+    float centerOf(const SDL_FRect& r, int axis) {
+      return axis == 0 ? r.x + r.w * Constants::DEFAULT_HALF : r.y + r.h * Constants::DEFAULT_HALF;
+    }
+  }
+
+  int32_t BVH::insert(const SDL_FRect& bounds, const Collider& collider, const SDL_FPoint& displacement) {
+    int32_t proxy = allocateNode();
+    nodes[proxy].bounds = fatten(bounds, displacement);
+    nodes[proxy].collider = collider;
+    nodes[proxy].height = 0;
+    insertLeaf(proxy);
+    ++proxyCount;
+    return proxy;
+  }
+
+  void BVH::remove(int32_t proxy) {
+    if (proxy < 0 || proxy >= static_cast<int32_t>(nodes.size())) return;
+    if (nodes[proxy].height != 0 || !nodes[proxy].isLeaf()) return;
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --proxyCount;
+  }
+
+  bool BVH::move(int32_t proxy, const SDL_FRect& bounds, const SDL_FPoint& displacement) {
+    if (contains(nodes[proxy].bounds, bounds)) return false;
+
+    SDL_FRect fat = fatten(bounds, displacement);
+    if (!SDL_HasIntersectionF(&nodes[proxy].bounds, &fat)) {
+      removeLeaf(proxy);
+      nodes[proxy].bounds = fat;
+      insertLeaf(proxy);
+      return true;
+    }
+
+    nodes[proxy].bounds = fat;
+    markDirty(nodes[proxy].parent);
+    return true;
+  }
+
+  void BVH::refit() {
+    if (dirtyNodes.empty()) return;
+    std::sort(dirtyNodes.begin(), dirtyNodes.end(), [this](int32_t a, int32_t b) {
+      return nodes[a].height < nodes[b].height;
+    });
+    for (size_t i = 0; i < dirtyNodes.size(); ++i) {
+      const int32_t index = dirtyNodes[i];
+      nodes[index].dirty = false;
+      refitNode(index);
+      if (rebalancing) rotate(index);
+    }
+    dirtyNodes.clear();
+  }
+
+  void BVH::rebuild() {
+    std::vector<int32_t> leaves;
+    leaves.reserve(proxyCount);
+    for (int32_t i = 0; i < static_cast<int32_t>(nodes.size()); ++i) {
+      BVHNode& node = nodes[i];
+      if (node.height < 0) continue;
+      if (node.isLeaf()) {
+        node.parent = NULL_NODE;
+        node.dirty = false;
+        leaves.push_back(i);
+      } else {
+        freeNode(i);
+      }
+    }
+    dirtyNodes.clear();
 
-  static SDL_FRect unionRect(const SDL_FRect& a, const SDL_FRect& b) {
-    const float left = std::min(a.x, b.x);
-    const float top = std::min(a.y, b.y);
-    const float right = std::max(a.x + a.w, b.x + b.w);
-    const float bottom = std::max(a.y + a.h, b.y + b.h);
-    return SDL_FRect{left, top, right - left, bottom - top};
+    root = leaves.empty() ? NULL_NODE : buildRecursive(leaves, 0, leaves.size());
+    if (root != NULL_NODE) nodes[root].parent = NULL_NODE;
   }
 
-  void BVH::build(std::vector<ObjPair> objects) {
+  std::vector<int32_t> BVH::build(const std::vector<std::pair<SDL_FRect, Collider>>& objects) {
     clear();
-    if (objects.empty()) return;
-    root = buildRecursive(objects, 0, static_cast<int>(objects.size()));
+    std::vector<int32_t> proxies;
+    proxies.reserve(objects.size());
+    nodes.reserve(objects.size() * Constants::INDEX_TWO);
+    for (const auto& [bounds, collider] : objects) {
+      int32_t proxy = allocateNode();
+      nodes[proxy].bounds = fatten(bounds, SDL_FPoint{0.f, 0.f});
+      nodes[proxy].collider = collider;
+      nodes[proxy].height = 0;
+      proxies.push_back(proxy);
+    }
+    proxyCount = proxies.size();
+    rebuild();
+    return proxies;
   }
 
   std::vector<Collider> BVH::query(const SDL_FRect& area) const {
     std::vector<Collider> result;
-    queryRecursive(root.get(), area, result);
+    query(area, [&result](const Collider& collider) { result.push_back(collider); });
     return result;
   }
 
   void BVH::clear() {
-    root.reset();
+    nodes.clear();
+    dirtyNodes.clear();
+    root = NULL_NODE;
+    freeList = NULL_NODE;
+    proxyCount = 0;
   }
 
-  std::unique_ptr<BVHNode> BVH::buildRecursive(std::vector<ObjPair>& objs, int start, int end) {
-    if (start >= end) return nullptr;
-    if (end - start == 1) {
-      auto node = std::make_unique<BVHNode>();
-      node->bounds = objs[start].first;
-      node->collider = objs[start].second;
-      return node;
+  int32_t BVH::allocateNode() {
+    int32_t index = freeList;
+    if (index == NULL_NODE) {
+      index = static_cast<int32_t>(nodes.size());
+      nodes.emplace_back();
+    } else {
+      freeList = nodes[index].parent;
     }
+    BVHNode& node = nodes[index];
+    node = BVHNode{};
+    node.height = 0;
+    return index;
+  }
 
-    SDL_FRect bounds = objs[start].first;
-    for (int i = start + 1; i < end; ++i) {
-      bounds = unionRect(bounds, objs[i].first);
+  void BVH::freeNode(int32_t index) {
+    BVHNode& node = nodes[index];
+    node = BVHNode{};
+    node.parent = freeList;
+    freeList = index;
+  }
+
+  void BVH::insertLeaf(int32_t leaf) {
+    if (root == NULL_NODE) {
+      root = leaf;
+      nodes[leaf].parent = NULL_NODE;
+      return;
     }
 
-    int axis = (bounds.w > bounds.h) ? 0 : 1;
-    int mid = (start + end) / Project::Libraries::Constants::INDEX_TWO;
-    std::nth_element(objs.begin() + start, objs.begin() + mid, objs.begin() + end,
-      [axis](const ObjPair& a, const ObjPair& b) {
-        return axis == 0 ? a.first.x < b.first.x : a.first.y < b.first.y;
-      });
+    const SDL_FRect leafBounds = nodes[leaf].bounds;
+    int32_t index = root;
+    while (!nodes[index].isLeaf()) {
+      const BVHNode& node = nodes[index];
+      const float area = perimeter(node.bounds);
+      const float combined = perimeter(unionRect(node.bounds, leafBounds));
+      const float cost = Constants::DEFAULT_DOUBLE * combined;
+      const float inheritance = Constants::DEFAULT_DOUBLE * (combined - area);
+
+      auto descendCost = [&](int32_t child) {
+        const BVHNode& c = nodes[child];
+        const float enlarged = perimeter(unionRect(c.bounds, leafBounds));
+        return c.isLeaf() ? enlarged + inheritance : enlarged - perimeter(c.bounds) + inheritance;
+      };
+      const float costLeft = descendCost(node.left);
+      const float costRight = descendCost(node.right);
+
+      if (cost < costLeft && cost < costRight) break;
+      index = costLeft < costRight ? node.left : node.right;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = nodes[sibling].parent;
+    const int32_t newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].bounds = unionRect(leafBounds, nodes[sibling].bounds);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].left = sibling;
+    nodes[newParent].right = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+    if (nodes[sibling].dirty) markDirty(newParent);
+
+    if (oldParent == NULL_NODE) {
+      root = newParent;
+    } else if (nodes[oldParent].left == sibling) {
+      nodes[oldParent].left = newParent;
+    } else {
+      nodes[oldParent].right = newParent;
+    }
 
-    auto node = std::make_unique<BVHNode>();
-    node->bounds = bounds;
-    node->left = buildRecursive(objs, start, mid);
-    node->right = buildRecursive(objs, mid, end);
-    return node;
+    refitUpwards(oldParent);
   }
 
-  void BVH::queryRecursive(const BVHNode* node, const SDL_FRect& area, std::vector<Collider>& out) const {
-    if (!node) return;
-    if (!SDL_HasIntersectionF(&node->bounds, &area)) return;
-    if (node->isLeaf()) {
-      out.push_back(node->collider);
+  void BVH::removeLeaf(int32_t leaf) {
+    if (leaf == root) {
+      root = NULL_NODE;
       return;
     }
-    queryRecursive(node->left.get(), area, out);
-    queryRecursive(node->right.get(), area, out);
+
+    const int32_t parent = nodes[leaf].parent;
+    const int32_t grandParent = nodes[parent].parent;
+    const int32_t sibling = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+
+    if (nodes[parent].dirty) {
+      dirtyNodes.erase(std::remove(dirtyNodes.begin(), dirtyNodes.end(), parent), dirtyNodes.end());
+    }
+
+    if (grandParent == NULL_NODE) {
+      root = sibling;
+      nodes[sibling].parent = NULL_NODE;
+      freeNode(parent);
+    } else {
+      if (nodes[grandParent].left == parent) {
+        nodes[grandParent].left = sibling;
+      } else {
+        nodes[grandParent].right = sibling;
+      }
+      nodes[sibling].parent = grandParent;
+      freeNode(parent);
+      refitUpwards(grandParent);
+    }
+    nodes[leaf].parent = NULL_NODE;
+  }
+
+  void BVH::refitUpwards(int32_t index) {
+    while (index != NULL_NODE) {
+      refitNode(index);
+      if (rebalancing) rotate(index);
+      index = nodes[index].parent;
+    }
+  }
+
+  void BVH::refitNode(int32_t index) {
+    BVHNode& node = nodes[index];
+    if (node.isLeaf()) return;
+    const BVHNode& left = nodes[node.left];
+    const BVHNode& right = nodes[node.right];
+    node.bounds = unionRect(left.bounds, right.bounds);
+    node.height = std::max(left.height, right.height) + 1;
+  }
+
+  void BVH::rotate(int32_t index) {
+    BVHNode& a = nodes[index];
+    if (a.isLeaf() || a.height < Constants::INDEX_TWO) return;
+
+    const int32_t b = a.left;
+    const int32_t c = a.right;
+    enum class Swap { NONE, C_D, C_E, B_F, B_G };
+    Swap best = Swap::NONE;
+    float bestDelta = 0.f;
+
+    if (!nodes[b].isLeaf()) {
+      const float base = perimeter(nodes[b].bounds);
+      const int32_t d = nodes[b].left;
+      const int32_t e = nodes[b].right;
+      const float cd = perimeter(unionRect(nodes[c].bounds, nodes[e].bounds)) - base;
+      const float ce = perimeter(unionRect(nodes[c].bounds, nodes[d].bounds)) - base;
+      if (cd < bestDelta) { bestDelta = cd; best = Swap::C_D; }
+      if (ce < bestDelta) { bestDelta = ce; best = Swap::C_E; }
+    }
+
+    if (!nodes[c].isLeaf()) {
+      const float base = perimeter(nodes[c].bounds);
+      const int32_t f = nodes[c].left;
+      const int32_t g = nodes[c].right;
+      const float bf = perimeter(unionRect(nodes[b].bounds, nodes[g].bounds)) - base;
+      const float bg = perimeter(unionRect(nodes[b].bounds, nodes[f].bounds)) - base;
+      if (bf < bestDelta) { bestDelta = bf; best = Swap::B_F; }
+      if (bg < bestDelta) { bestDelta = bg; best = Swap::B_G; }
+    }
+
+    auto swapChild = [this, index](int32_t child, int32_t parent, bool replaceLeft, bool childIsLeftOfA) {
+      int32_t grandChild = replaceLeft ? nodes[parent].left : nodes[parent].right;
+      if (childIsLeftOfA) {
+        nodes[index].left = grandChild;
+      } else {
+        nodes[index].right = grandChild;
+      }
+      nodes[grandChild].parent = index;
+      if (replaceLeft) {
+        nodes[parent].left = child;
+      } else {
+        nodes[parent].right = child;
+      }
+      nodes[child].parent = parent;
+      if (nodes[child].dirty || nodes[grandChild].dirty) markDirty(parent);
+      refitNode(parent);
+      refitNode(index);
+    };
+
+    switch (best) {
+      case Swap::C_D: swapChild(c, b, true, false); break;
+      case Swap::C_E: swapChild(c, b, false, false); break;
+      case Swap::B_F: swapChild(b, c, true, true); break;
+      case Swap::B_G: swapChild(b, c, false, true); break;
+      default: break;
+    }
+  }
+
+  void BVH::markDirty(int32_t index) {
+    while (index != NULL_NODE && !nodes[index].dirty) {
+      nodes[index].dirty = true;
+      dirtyNodes.push_back(index);
+      index = nodes[index].parent;
+    }
+  }
+
+  int32_t BVH::buildRecursive(std::vector<int32_t>& leaves, size_t start, size_t end) {
+    if (end - start == 1) return leaves[start];
+
+    SDL_FRect bounds = nodes[leaves[start]].bounds;
+    float minCenter[Constants::INDEX_TWO] = {centerOf(bounds, 0), centerOf(bounds, 1)};
+    float maxCenter[Constants::INDEX_TWO] = {minCenter[0], minCenter[1]};
+    for (size_t i = start + 1; i < end; ++i) {
+      const SDL_FRect& b = nodes[leaves[i]].bounds;
+      bounds = unionRect(bounds, b);
+      for (int axis = 0; axis < Constants::INDEX_TWO; ++axis) {
+        minCenter[axis] = std::min(minCenter[axis], centerOf(b, axis));
+        maxCenter[axis] = std::max(maxCenter[axis], centerOf(b, axis));
+      }
+    }
+
+    const int axis = (maxCenter[0] - minCenter[0]) >= (maxCenter[1] - minCenter[1]) ? 0 : 1;
+    const float extent = maxCenter[axis] - minCenter[axis];
+    size_t mid = start + (end - start) / Constants::INDEX_TWO;
+
+    if (extent > 0.f) {
+      struct Bin {
+        SDL_FRect bounds{0.f, 0.f, 0.f, 0.f};
+        size_t count = 0;
+      };
+      std::array<Bin, Constants::BVH_SAH_BIN_COUNT> bins{};
+      const float scale = static_cast<float>(Constants::BVH_SAH_BIN_COUNT) / extent;
+      auto binOf = [&](int32_t leaf) {
+        size_t bin = static_cast<size_t>((centerOf(nodes[leaf].bounds, axis) - minCenter[axis]) * scale);
+        return std::min(bin, Constants::BVH_SAH_BIN_COUNT - 1);
+      };
+
+      for (size_t i = start; i < end; ++i) {
+        Bin& bin = bins[binOf(leaves[i])];
+        bin.bounds = bin.count == 0 ? nodes[leaves[i]].bounds : unionRect(bin.bounds, nodes[leaves[i]].bounds);
+        ++bin.count;
+      }
+
+      std::array<float, Constants::BVH_SAH_BIN_COUNT> leftCost{};
+      SDL_FRect accumulated{0.f, 0.f, 0.f, 0.f};
+      size_t accumulatedCount = 0;
+      for (size_t i = 0; i + 1 < Constants::BVH_SAH_BIN_COUNT; ++i) {
+        if (bins[i].count > 0) {
+          accumulated = accumulatedCount == 0 ? bins[i].bounds : unionRect(accumulated, bins[i].bounds);
+          accumulatedCount += bins[i].count;
+        }
+        leftCost[i] = accumulatedCount * perimeter(accumulated);
+      }
+
+      float bestCost = 0.f;
+      size_t bestSplit = Constants::BVH_SAH_BIN_COUNT;
+      accumulatedCount = 0;
+      for (size_t i = Constants::BVH_SAH_BIN_COUNT - 1; i > 0; --i) {
+        if (bins[i].count > 0) {
+          accumulated = accumulatedCount == 0 ? bins[i].bounds : unionRect(accumulated, bins[i].bounds);
+          accumulatedCount += bins[i].count;
+        }
+        const float cost = leftCost[i - 1] + accumulatedCount * perimeter(accumulated);
+        if (bestSplit == Constants::BVH_SAH_BIN_COUNT || cost < bestCost) {
+          bestCost = cost;
+          bestSplit = i;
+        }
+      }
+
+      auto split = std::partition(leaves.begin() + start, leaves.begin() + end,
+        [&](int32_t leaf) { return binOf(leaf) < bestSplit; });
+      mid = static_cast<size_t>(split - leaves.begin());
+    }
+
+    if (mid == start || mid == end) {
+      mid = start + (end - start) / Constants::INDEX_TWO;
+      std::nth_element(leaves.begin() + start, leaves.begin() + mid, leaves.begin() + end,
+        [&](int32_t a, int32_t b) { return centerOf(nodes[a].bounds, axis) < centerOf(nodes[b].bounds, axis); });
+    }
+
+    const int32_t left = buildRecursive(leaves, start, mid);
+    const int32_t right = buildRecursive(leaves, mid, end);
+    const int32_t index = allocateNode();
+    BVHNode& node = nodes[index];
+    node.left = left;
+    node.right = right;
+    node.bounds = unionRect(nodes[left].bounds, nodes[right].bounds);
+    node.height = std::max(nodes[left].height, nodes[right].height) + 1;
+    nodes[left].parent = index;
+    nodes[right].parent = index;
+    return index;
   }
 }
@@ -1,34 +1,104 @@
 #ifndef BVH_H
 #define BVH_H
 
-#include <memory>
+#include <array>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <SDL.h>
 
 #include "SpatialHashGrid.h"
+#include "libraries/constants/NumericConstants.h"
 
 namespace Project::Utilities {
   struct BVHNode {
+    static constexpr int32_t NULL_NODE = -1;
+
     SDL_FRect bounds{0,0,0,0};
     Collider collider{};
-    std::unique_ptr<BVHNode> left;
-    std::unique_ptr<BVHNode> right;
-    bool isLeaf() const { return !left && !right && (collider.box || collider.physics); }
+    int32_t parent = NULL_NODE;
+    int32_t left = NULL_NODE;
+    int32_t right = NULL_NODE;
+    int32_t height = -1;
+    bool dirty = false;
+
+    bool isLeaf() const { return left == NULL_NODE; }
   };
 
   class BVH {
   public:
-    void build(std::vector<std::pair<SDL_FRect, Collider>> objects);
+    static constexpr int32_t NULL_NODE = BVHNode::NULL_NODE;
+
+    int32_t insert(const SDL_FRect& bounds, const Collider& collider, const SDL_FPoint& displacement = SDL_FPoint{0.f, 0.f});
+    void remove(int32_t proxy);
+    bool move(int32_t proxy, const SDL_FRect& bounds, const SDL_FPoint& displacement = SDL_FPoint{0.f, 0.f});
+    void refit();
+    void rebuild();
+
+    std::vector<int32_t> build(const std::vector<std::pair<SDL_FRect, Collider>>& objects);
     std::vector<Collider> query(const SDL_FRect& area) const;
+    template <typename F>
+    void query(const SDL_FRect& area, F&& callback) const;
     void clear();
 
+    void setRebalancing(bool enabled) { rebalancing = enabled; }
+    bool isRebalancing() const { return rebalancing; }
+
+    const SDL_FRect& getFatBounds(int32_t proxy) const { return nodes[proxy].bounds; }
+    const Collider& getCollider(int32_t proxy) const { return nodes[proxy].collider; }
+    void setCollider(int32_t proxy, const Collider& collider) { nodes[proxy].collider = collider; }
+
+    size_t getProxyCount() const { return proxyCount; }
+    int32_t getHeight() const { return root == NULL_NODE ? 0 : nodes[root].height; }
+
   private:
-    std::unique_ptr<BVHNode> root;
-    std::unique_ptr<BVHNode> buildRecursive(std::vector<std::pair<SDL_FRect, Collider>>& objs, int start, int end);
-    void queryRecursive(const BVHNode* node, const SDL_FRect& area, std::vector<Collider>& out) const;
-    
+    std::vector<BVHNode> nodes;
+    std::vector<int32_t> dirtyNodes;
+    int32_t root = NULL_NODE;
+    int32_t freeList = NULL_NODE;
+    size_t proxyCount = 0;
+    bool rebalancing = true;
+
+    int32_t allocateNode();
+    void freeNode(int32_t index);
+
+    void insertLeaf(int32_t leaf);
+    void removeLeaf(int32_t leaf);
+    void refitUpwards(int32_t index);
+    void refitNode(int32_t index);
+    void rotate(int32_t index);
+    void markDirty(int32_t index);
+    int32_t buildRecursive(std::vector<int32_t>& leaves, size_t start, size_t end);
   };
+
+  template <typename F>
+  void BVH::query(const SDL_FRect& area, F&& callback) const {
+    if (root == NULL_NODE) return;
+    std::array<int32_t, Project::Libraries::Constants::BVH_QUERY_STACK_SIZE> fixed;
+    std::vector<int32_t> overflow;
+    int32_t* stack = fixed.data();
+    size_t capacity = fixed.size();
+    size_t count = 0;
+    stack[count++] = root;
+    while (count > 0) {
+      const BVHNode& node = nodes[stack[--count]];
+      if (!SDL_HasIntersectionF(&node.bounds, &area)) continue;
+      if (node.isLeaf()) {
+        callback(node.collider);
+        continue;
+      }
+      if (count + 2 > capacity) {
+        // Only trees left unbalanced get this deep; everything else stays off the heap.
+        if (overflow.empty()) overflow.assign(fixed.begin(), fixed.begin() + count);
+        overflow.resize(capacity * 2);
+        stack = overflow.data();
+        capacity = overflow.size();
+      }
+      stack[count++] = node.left;
+      stack[count++] = node.right;
+    }
+  }
 }
 
 #endif
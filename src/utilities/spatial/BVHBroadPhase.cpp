@@ -0,0 +1,55 @@
+#include "BVHBroadPhase.h"
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  void BVHBroadPhase::build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect&) {
+    ++frame;
+    inserted = 0;
+    for (const auto& proxy : proxies) {
+      sync(proxy);
+    }
+
+    for (auto it = nodes.begin(); it != nodes.end();) {
+      if (it->second.frame != frame) {
+        bvh.remove(it->second.node);
+        it = nodes.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    if (inserted >= Constants::BVH_REBUILD_MIN_INSERTS && inserted * Constants::INDEX_TWO >= bvh.getProxyCount()) {
+      bvh.rebuild();
+    } else {
+      bvh.refit();
+    }
+  }
+
+  void BVHBroadPhase::query(const SDL_FRect& area, const QueryCallback& callback) const {
+    bvh.query(area, callback);
+  }
+
+  void BVHBroadPhase::clear() {
+    bvh.clear();
+    nodes.clear();
+  }
+
+  void BVHBroadPhase::sync(const BroadPhaseProxy& proxy) {
+    auto [it, added] = nodes.try_emplace(proxy.collider.box);
+    Proxy& entry = it->second;
+    if (added || entry.node == BVH::NULL_NODE) {
+      entry.node = bvh.insert(proxy.bounds, proxy.collider, proxy.displacement);
+      ++inserted;
+    } else {
+      const auto& current = bvh.getCollider(entry.node);
+      if (current.physics != proxy.collider.physics || current.entity != proxy.collider.entity) {
+        bvh.setCollider(entry.node, proxy.collider);
+      }
+      bvh.move(entry.node, proxy.bounds, proxy.displacement);
+    }
+    entry.frame = frame;
+  }
+}
@@ -0,0 +1,36 @@
+#ifndef BVH_BROAD_PHASE_H
+#define BVH_BROAD_PHASE_H
+
+#include "BroadPhase.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "BVH.h"
+
+namespace Project::Utilities {
+  class BVHBroadPhase : public BroadPhase {
+  public:
+    using BroadPhase::query;
+
+    BroadPhaseType getType() const override { return BroadPhaseType::BVH; }
+    void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) override;
+    void query(const SDL_FRect& area, const QueryCallback& callback) const override;
+    void clear() override;
+
+  private:
+    struct Proxy {
+      int32_t node = BVH::NULL_NODE;
+      uint64_t frame = 0;
+    };
+
+    BVH bvh;
+    std::unordered_map<Project::Components::BoundingBoxComponent*, Proxy> nodes;
+    uint64_t frame = 0;
+    size_t inserted = 0;
+
+    void sync(const BroadPhaseProxy& proxy);
+  };
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include "BroadPhase.h"
+
+#include "AutoBroadPhase.h"
+#include "BVHBroadPhase.h"
+#include "GridBroadPhase.h"
+#include "QuadTreeBroadPhase.h"
+#include "SweepAndPruneBroadPhase.h"
+
+namespace Project::Utilities {
+  std::unique_ptr<BroadPhase> BroadPhase::create(BroadPhaseType type) {
+    switch (type) {
+      case BroadPhaseType::BVH: return std::make_unique<BVHBroadPhase>();
+      case BroadPhaseType::GRID: return std::make_unique<GridBroadPhase>();
+      case BroadPhaseType::QUAD_TREE: return std::make_unique<QuadTreeBroadPhase>();
+      case BroadPhaseType::SWEEP_AND_PRUNE: return std::make_unique<SweepAndPruneBroadPhase>();
+      case BroadPhaseType::AUTO: default: return std::make_unique<AutoBroadPhase>();
+    }
+  }
+
+  bool BroadPhase::collectPairs(std::vector<ColliderPair>&) const {
+    return false;
+  }
+
+  const std::vector<ColliderPair>& BroadPhase::getAddedPairs() const {
+    static const std::vector<ColliderPair> none;
+    return none;
+  }
+
+  const std::vector<ColliderPair>& BroadPhase::getRemovedPairs() const {
+    static const std::vector<ColliderPair> none;
+    return none;
+  }
+
+  std::vector<Collider> BroadPhase::query(const SDL_FRect& area) const {
+    std::vector<Collider> result;
+    query(area, result);
+    return result;
+  }
+
+  void BroadPhase::query(const SDL_FRect& area, std::vector<Collider>& results) const {
+    results.clear();
+    query(area, [&results](const Collider& collider) { results.push_back(collider); });
+  }
+}
@@ -0,0 +1,44 @@
+#ifndef BROAD_PHASE_H
+#define BROAD_PHASE_H
+
+#include "BroadPhaseType.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <SDL.h>
+
+#include "SpatialHashGrid.h"
+
+namespace Project::Utilities {
+  struct BroadPhaseProxy {
+    SDL_FRect bounds{0.f, 0.f, 0.f, 0.f};
+    Collider collider{};
+    SDL_FPoint displacement{0.f, 0.f};
+  };
+
+  class BroadPhase {
+  public:
+    using QueryCallback = std::function<void(const Collider&)>;
+
+    virtual ~BroadPhase() = default;
+
+    static std::unique_ptr<BroadPhase> create(BroadPhaseType type);
+
+    virtual BroadPhaseType getType() const = 0;
+    virtual void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) = 0;
+    virtual void query(const SDL_FRect& area, const QueryCallback& callback) const = 0;
+    virtual void clear() = 0;
+
+    virtual bool tracksPairs() const { return false; }
+    virtual bool collectPairs(std::vector<ColliderPair>& pairs) const;
+    virtual const std::vector<ColliderPair>& getAddedPairs() const;
+    virtual const std::vector<ColliderPair>& getRemovedPairs() const;
+
+    std::vector<Collider> query(const SDL_FRect& area) const;
+    void query(const SDL_FRect& area, std::vector<Collider>& results) const;
+  };
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef BROAD_PHASE_TYPE_H
+#define BROAD_PHASE_TYPE_H
+
+namespace Project::Utilities {
+  enum class BroadPhaseType {
+    AUTO,
+    BVH,
+    GRID,
+    QUAD_TREE,
+    SWEEP_AND_PRUNE
+  };
+}
+
+#endif
@@ -0,0 +1,26 @@
+#include "BroadPhaseTypeResolver.h"
+
+#include <array>
+#include <string_view>
+
+#include "libraries/modes/BroadPhaseModes.h"
+#include "utilities/string/StringUtils.h"
+
+namespace Project::Utilities {
+  namespace BroadPhases = Project::Libraries::Modes::BroadPhases;
+
+  BroadPhaseType BroadPhaseTypeResolver::resolve(std::string_view name, BroadPhaseType fallback) {
+    static constexpr std::array<std::pair<std::string_view, BroadPhaseType>, BroadPhases::BROAD_PHASE_NAME_ALIAS_COUNT> map{{
+      {BroadPhases::AUTO, BroadPhaseType::AUTO},
+      {BroadPhases::BVH, BroadPhaseType::BVH},
+      {BroadPhases::GRID, BroadPhaseType::GRID},
+      {BroadPhases::QUAD_TREE, BroadPhaseType::QUAD_TREE},
+      {BroadPhases::SWEEP_AND_PRUNE, BroadPhaseType::SWEEP_AND_PRUNE}
+    }};
+
+    for (const auto& [key, value] : map) {
+      if (StringUtils::iequals(key, name)) return value;
+    }
+    return fallback;
+  }
+}
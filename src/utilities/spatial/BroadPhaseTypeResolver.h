@@ -0,0 +1,15 @@
+#ifndef BROAD_PHASE_TYPE_RESOLVER_H
+#define BROAD_PHASE_TYPE_RESOLVER_H
+
+#include "BroadPhaseType.h"
+
+#include <string_view>
+
+namespace Project::Utilities {
+  class BroadPhaseTypeResolver {
+  public:
+    static BroadPhaseType resolve(std::string_view name, BroadPhaseType fallback = BroadPhaseType::AUTO);
+  };
+}
+
+#endif
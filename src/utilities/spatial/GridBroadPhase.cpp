@@ -0,0 +1,35 @@
+#include "GridBroadPhase.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  namespace {
+    SDL_Rect toGridRect(const SDL_FRect& rect) {
+      return SDL_Rect{
+        static_cast<int>(std::floor(rect.x)),
+        static_cast<int>(std::floor(rect.y)),
+        static_cast<int>(std::ceil(rect.w)),
+        static_cast<int>(std::ceil(rect.h))
+      };
+    }
+  }
+
+  void GridBroadPhase::build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) {
+    const float area = worldBounds.w * worldBounds.h;
+    float targetCell = std::sqrt(area / (static_cast<float>(proxies.size()) + Constants::DEFAULT_WHOLE));
+    grid.setCellSize(std::clamp(targetCell, Constants::MIN_CELL, Constants::MAX_CELL));
+
+    for (const auto& proxy : proxies) {
+      grid.insert(proxy.collider, toGridRect(proxy.bounds));
+    }
+  }
+
+  void GridBroadPhase::query(const SDL_FRect& area, const QueryCallback& callback) const {
+    grid.query(toGridRect(area), callback);
+  }
+}
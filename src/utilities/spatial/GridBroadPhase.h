@@ -0,0 +1,23 @@
+#ifndef GRID_BROAD_PHASE_H
+#define GRID_BROAD_PHASE_H
+
+#include "BroadPhase.h"
+
+#include "SpatialHashGrid.h"
+
+namespace Project::Utilities {
+  class GridBroadPhase : public BroadPhase {
+  public:
+    using BroadPhase::query;
+
+    BroadPhaseType getType() const override { return BroadPhaseType::GRID; }
+    void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) override;
+    void query(const SDL_FRect& area, const QueryCallback& callback) const override;
+    void clear() override { grid.clear(); }
+
+  private:
+    SpatialHashGrid grid;
+  };
+}
+
+#endif
@@ -0,0 +1,23 @@
+#include "QuadTreeBroadPhase.h"
+
+#include "libraries/constants/Constants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  QuadTreeBroadPhase::QuadTreeBroadPhase()
+  : tree(SDL_FRect{0.f, 0.f, static_cast<float>(Constants::INT_TEN_THOUSAND), static_cast<float>(Constants::INT_TEN_THOUSAND)}) {}
+
+  void QuadTreeBroadPhase::build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) {
+    tree = QuadTree(worldBounds);
+    for (const auto& proxy : proxies) {
+      tree.insert(proxy.collider, proxy.bounds);
+    }
+  }
+
+  void QuadTreeBroadPhase::query(const SDL_FRect& area, const QueryCallback& callback) const {
+    for (const auto& collider : tree.query(area)) {
+      callback(collider);
+    }
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef QUAD_TREE_BROAD_PHASE_H
+#define QUAD_TREE_BROAD_PHASE_H
+
+#include "BroadPhase.h"
+
+#include "QuadTree.h"
+
+namespace Project::Utilities {
+  class QuadTreeBroadPhase : public BroadPhase {
+  public:
+    using BroadPhase::query;
+
+    QuadTreeBroadPhase();
+
+    BroadPhaseType getType() const override { return BroadPhaseType::QUAD_TREE; }
+    void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) override;
+    void query(const SDL_FRect& area, const QueryCallback& callback) const override;
+    void clear() override { tree.clear(); }
+
+  private:
+    QuadTree tree;
+  };
+}
+
+#endif
@@ -1,59 +1,111 @@
 #include "SpatialHashGrid.h"
 
+#include <algorithm>
 #include <cmath>
 
+#include "libraries/constants/IndexConstants.h"
+#include "libraries/constants/MiscellaneousConstants.h"
 #include "libraries/constants/NumericConstants.h"
 
 namespace Project::Utilities {
-  using Project::Components::PhysicsComponent;
-  using Project::Components::BoundingBoxComponent;
-  using Project::Entities::Entity;
+  namespace Constants = Project::Libraries::Constants;
 
-  SpatialHashGrid::SpatialHashGrid(float cellSize) : cellSize(cellSize) {}
+  SpatialHashGrid::SpatialHashGrid(float cellSize) : cellSize(cellSize) {
+    slots.resize(Constants::SPATIAL_HASH_INITIAL_SLOTS);
+  }
+
+  void SpatialHashGrid::query(const SDL_Rect& area, std::vector<Collider>& results) const {
+    results.clear();
+    query(area, [&results](const Collider& collider) { results.push_back(collider); });
+  }
 
-  std::vector<Collider> SpatialHashGrid::query(const SDL_Rect& area) const {
-    std::vector<Collider> result;
-    std::unordered_set<void*> seen;
-    int minX = static_cast<int>(std::floor(static_cast<float>(area.x) / cellSize));
-    int minY = static_cast<int>(std::floor(static_cast<float>(area.y) / cellSize));
-    int maxX = static_cast<int>(std::floor(static_cast<float>(area.x + area.w) / cellSize));
-    int maxY = static_cast<int>(std::floor(static_cast<float>(area.y + area.h) / cellSize));
+  void SpatialHashGrid::insert(const Collider& obj, const SDL_Rect& bounds) {
+    const uint32_t index = static_cast<uint32_t>(colliders.size());
+    colliders.push_back(obj);
+    if (queryStamps.size() < colliders.size()) queryStamps.push_back(0);
 
+    int minX, minY, maxX, maxY;
+    cellRange(bounds, minX, minY, maxX, maxY);
     for (int x = minX; x <= maxX; ++x) {
       for (int y = minY; y <= maxY; ++y) {
-        auto it = cells.find(hash(x, y));
-        if (it != cells.end()) {
-          for (const auto& obj : it->second) {
-            void* key = obj.physics ? static_cast<void*>(obj.physics) : static_cast<void*>(obj.box);
-            if (seen.insert(key).second) {
-              result.push_back(obj);
-            }
-          }
-        }
+        Slot& slot = acquireSlot(hash(x, y));
+        entries.push_back(Entry{index, slot.head});
+        slot.head = static_cast<int32_t>(entries.size() - 1);
       }
     }
+  }
+
+  void SpatialHashGrid::clear() {
+    entries.clear();
+    colliders.clear();
+    occupied = 0;
+    if (++generation == 0) {
+      for (auto& slot : slots) slot.generation = 0;
+      generation = 1;
+    }
+  }
 
-    return result;
+  uint64_t SpatialHashGrid::hash(int x, int y) const {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << Constants::BIT_32) | static_cast<uint64_t>(static_cast<uint32_t>(y));
   }
 
-  void SpatialHashGrid::insert(const Collider& obj, const SDL_Rect& bounds) {
-    int minX = static_cast<int>(std::floor(static_cast<float>(bounds.x) / cellSize));
-    int minY = static_cast<int>(std::floor(static_cast<float>(bounds.y) / cellSize));
-    int maxX = static_cast<int>(std::floor(static_cast<float>(bounds.x + bounds.w) / cellSize));
-    int maxY = static_cast<int>(std::floor(static_cast<float>(bounds.y + bounds.h) / cellSize));
-    for (int x = minX; x <= maxX; ++x) {
-      for (int y = minY; y <= maxY; ++y) {
-        cells[hash(x, y)].push_back(obj);
+  size_t SpatialHashGrid::probeStart(uint64_t key) const {
+    const uint64_t mixed = key * Constants::DEFAULT_HASH;
+    return static_cast<size_t>(mixed >> Constants::BIT_32) & (slots.size() - 1);
+  }
+
+  const SpatialHashGrid::Slot* SpatialHashGrid::findSlot(uint64_t key) const {
+    const size_t mask = slots.size() - 1;
+    for (size_t i = probeStart(key);; i = (i + 1) & mask) {
+      const Slot& slot = slots[i];
+      if (slot.generation != generation) return nullptr;
+      if (slot.key == key) return &slot;
+    }
+  }
+
+  SpatialHashGrid::Slot& SpatialHashGrid::acquireSlot(uint64_t key) {
+    if ((occupied + 1) * Constants::INDEX_TWO > slots.size()) grow();
+
+    const size_t mask = slots.size() - 1;
+    for (size_t i = probeStart(key);; i = (i + 1) & mask) {
+      Slot& slot = slots[i];
+      if (slot.generation != generation) {
+        slot.key = key;
+        slot.head = NULL_ENTRY;
+        slot.generation = generation;
+        ++occupied;
+        return slot;
       }
+      if (slot.key == key) return slot;
     }
   }
 
-  void SpatialHashGrid::clear() {
-    cells.clear();
+  void SpatialHashGrid::grow() {
+    std::vector<Slot> previous(slots.size() * Constants::INDEX_TWO);
+    previous.swap(slots);
+
+    const size_t mask = slots.size() - 1;
+    for (const Slot& slot : previous) {
+      if (slot.generation != generation) continue;
+      size_t i = probeStart(slot.key);
+      while (slots[i].generation == generation) i = (i + 1) & mask;
+      slots[i] = slot;
+    }
+  }
+
+  uint32_t SpatialHashGrid::nextQueryStamp() const {
+    if (++queryStamp == 0) {
+      std::fill(queryStamps.begin(), queryStamps.end(), 0);
+      queryStamp = 1;
+    }
+    return queryStamp;
   }
 
-  long long SpatialHashGrid::hash(int x, int y) const {
-    return (static_cast<long long>(x) << Project::Libraries::Constants::BIT_32) ^ static_cast<unsigned long long>(y);
+  void SpatialHashGrid::cellRange(const SDL_Rect& area, int& minX, int& minY, int& maxX, int& maxY) const {
+    minX = static_cast<int>(std::floor(static_cast<float>(area.x) / cellSize));
+    minY = static_cast<int>(std::floor(static_cast<float>(area.y) / cellSize));
+    maxX = static_cast<int>(std::floor(static_cast<float>(area.x + area.w) / cellSize));
+    maxY = static_cast<int>(std::floor(static_cast<float>(area.y + area.h) / cellSize));
   }
 
   void SpatialHashGrid::setCellSize(float newSize) {
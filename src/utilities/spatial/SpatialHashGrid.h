@@ -1,8 +1,8 @@
 #ifndef SPATIAL_HASH_GRID_H
 #define SPATIAL_HASH_GRID_H
 
-#include <unordered_map>
-#include <unordered_set>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <SDL.h>
@@ -21,24 +21,77 @@ namespace Project::Utilities {
     Project::Entities::Entity* entity = nullptr;
   };
 
+  using ColliderPair = std::pair<Collider, Collider>;
+
   class SpatialHashGrid {
   public:
     explicit SpatialHashGrid(float cellSize = Project::Libraries::Constants::DEFAULT_CELL_SIZE);
     
-    std::vector<Collider> query(const SDL_Rect& area) const;
+    void query(const SDL_Rect& area, std::vector<Collider>& results) const;
+    template <typename F>
+    void query(const SDL_Rect& area, F&& callback) const;
     void insert(const Collider& obj, const SDL_Rect& bounds);
     void clear();
 
     float getCellSize() const { return cellSize; }
     void setCellSize(float newSize);
 
+    size_t getColliderCount() const { return colliders.size(); }
+
   private:
-    using Cell = std::vector<Collider>;
-    std::unordered_map<long long, Cell> cells;
+    static constexpr int32_t NULL_ENTRY = -1;
+
+    struct Slot {
+      uint64_t key = 0;
+      int32_t head = NULL_ENTRY;
+      uint32_t generation = 0;
+    };
+
+    struct Entry {
+      uint32_t collider = 0;
+      int32_t next = NULL_ENTRY;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<Entry> entries;
+    std::vector<Collider> colliders;
+    mutable std::vector<uint32_t> queryStamps;
 
     float cellSize;
-    long long hash(int x, int y) const;
+    size_t occupied = 0;
+    uint32_t generation = 1;
+    mutable uint32_t queryStamp = 0;
+
+    uint64_t hash(int x, int y) const;
+    size_t probeStart(uint64_t key) const;
+    const Slot* findSlot(uint64_t key) const;
+    Slot& acquireSlot(uint64_t key);
+    void grow();
+    uint32_t nextQueryStamp() const;
+    void cellRange(const SDL_Rect& area, int& minX, int& minY, int& maxX, int& maxY) const;
   };
+
+  template <typename F>
+  void SpatialHashGrid::query(const SDL_Rect& area, F&& callback) const {
+    if (colliders.empty()) return;
+
+    const uint32_t stamp = nextQueryStamp();
+    int minX, minY, maxX, maxY;
+    cellRange(area, minX, minY, maxX, maxY);
+
+    for (int x = minX; x <= maxX; ++x) {
+      for (int y = minY; y <= maxY; ++y) {
+        const Slot* slot = findSlot(hash(x, y));
+        if (!slot) continue;
+        for (int32_t entry = slot->head; entry != NULL_ENTRY; entry = entries[entry].next) {
+          const uint32_t index = entries[entry].collider;
+          if (queryStamps[index] == stamp) continue;
+          queryStamps[index] = stamp;
+          callback(colliders[index]);
+        }
+      }
+    }
+  }
 }
 
 #endif
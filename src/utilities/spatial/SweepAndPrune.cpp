@@ -1,25 +1,290 @@
 #include "SweepAndPrune.h"
 
 #include <algorithm>
+#include <utility>
 
 namespace Project::Utilities {
-  std::vector<SweepAndPrune::Pair> SweepAndPrune::findPairs(const std::vector<std::pair<SDL_FRect, Collider>>& objects) {
-    std::vector<std::pair<SDL_FRect, Collider>> sorted = objects;
-    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
-      return a.first.x < b.first.x;
-    });
-
-    std::vector<Pair> pairs;
-    for (size_t i = 0; i < sorted.size(); ++i) {
-      const auto& A = sorted[i];
-      for (size_t j = i + 1; j < sorted.size(); ++j) {
-        const auto& B = sorted[j];
-        if (B.first.x > A.first.x + A.first.w) break;
-        if (SDL_HasIntersectionF(&A.first, &B.first)) {
-          pairs.emplace_back(A.second, B.second);
+  namespace Constants = Project::Libraries::Constants;
+
+  SweepAndPrune::ProxyId SweepAndPrune::insert(const SDL_FRect& bounds, const Collider& collider) {
+    ProxyId id;
+    if (!freeProxies.empty()) {
+      id = freeProxies.back();
+      freeProxies.pop_back();
+    } else {
+      id = static_cast<ProxyId>(proxies.size());
+      proxies.emplace_back();
+    }
+
+    Proxy& proxy = proxies[id];
+    proxy.bounds = bounds;
+    proxy.collider = collider;
+    proxy.active = true;
+    maxWidth = std::max(maxWidth, bounds.w);
+
+    if (batching) {
+      for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+        auto& endpoints = axes[axis];
+        proxy.min[axis] = static_cast<uint32_t>(endpoints.size());
+        endpoints.push_back(Endpoint{minValue(bounds, axis), id, false});
+        proxy.max[axis] = static_cast<uint32_t>(endpoints.size());
+        endpoints.push_back(Endpoint{maxValue(bounds, axis), id, true});
+      }
+      return id;
+    }
+
+    for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+      auto& endpoints = axes[axis];
+      const float limit = std::numeric_limits<float>::max();
+      proxy.min[axis] = static_cast<uint32_t>(endpoints.size());
+      endpoints.push_back(Endpoint{limit, id, false});
+      proxy.max[axis] = static_cast<uint32_t>(endpoints.size());
+      endpoints.push_back(Endpoint{limit, id, true});
+    }
+
+    for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+      auto& endpoints = axes[axis];
+      endpoints[proxies[id].min[axis]].value = minValue(bounds, axis);
+      sortDown(axis, proxies[id].min[axis], axis == AXIS_COUNT - 1);
+      endpoints[proxies[id].max[axis]].value = maxValue(bounds, axis);
+      sortDown(axis, proxies[id].max[axis], axis == AXIS_COUNT - 1);
+    }
+    return id;
+  }
+
+  void SweepAndPrune::remove(ProxyId id) {
+    if (id >= proxies.size() || !proxies[id].active) return;
+
+    if (batching) {
+      proxies[id].active = false;
+      batchFreed.push_back(id);
+      return;
+    }
+
+    const float limit = std::numeric_limits<float>::max();
+    for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+      auto& endpoints = axes[axis];
+      endpoints[proxies[id].max[axis]].value = limit;
+      sortUp(axis, proxies[id].max[axis], true);
+      endpoints[proxies[id].min[axis]].value = limit;
+      sortUp(axis, proxies[id].min[axis], true);
+      endpoints.pop_back();
+      endpoints.pop_back();
+    }
+
+    proxies[id].active = false;
+    frameFreed.push_back(id);
+  }
+
+  void SweepAndPrune::move(ProxyId id, const SDL_FRect& bounds) {
+    if (id >= proxies.size() || !proxies[id].active) return;
+    proxies[id].bounds = bounds;
+    maxWidth = std::max(maxWidth, bounds.w);
+
+    if (batching) {
+      for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+        axes[axis][proxies[id].min[axis]].value = minValue(bounds, axis);
+        axes[axis][proxies[id].max[axis]].value = maxValue(bounds, axis);
+      }
+      return;
+    }
+
+    for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+      auto& endpoints = axes[axis];
+      const uint32_t minIndex = proxies[id].min[axis];
+      const uint32_t maxIndex = proxies[id].max[axis];
+      const float newMin = minValue(bounds, axis);
+      const float newMax = maxValue(bounds, axis);
+      const float oldMin = endpoints[minIndex].value;
+      const float oldMax = endpoints[maxIndex].value;
+
+      endpoints[minIndex].value = newMin;
+      endpoints[maxIndex].value = newMax;
+
+      if (newMin < oldMin) sortDown(axis, minIndex, true);
+      if (newMax > oldMax) sortUp(axis, proxies[id].max[axis], true);
+      if (newMin > oldMin) sortUp(axis, proxies[id].min[axis], true);
+      if (newMax < oldMax) sortDown(axis, proxies[id].max[axis], true);
+    }
+  }
+
+  void SweepAndPrune::clear() {
+    for (auto& endpoints : axes) endpoints.clear();
+    proxies.clear();
+    freeProxies.clear();
+    batchFreed.clear();
+    frameFreed.clear();
+    pairs.clear();
+    pairEvents.clear();
+    addedPairs.clear();
+    removedPairs.clear();
+    maxWidth = 0.0f;
+    batching = false;
+  }
+
+  void SweepAndPrune::beginBatch() {
+    batching = true;
+  }
+
+  void SweepAndPrune::endBatch() {
+    if (!batching) return;
+    batching = false;
+
+    for (int axis = 0; axis < AXIS_COUNT; ++axis) {
+      auto& endpoints = axes[axis];
+      endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [this](const Endpoint& endpoint) {
+        return !proxies[endpoint.proxy].active;
+      }), endpoints.end());
+
+      std::sort(endpoints.begin(), endpoints.end(), [](const Endpoint& a, const Endpoint& b) {
+        if (a.value != b.value) return a.value < b.value;
+        if (a.max != b.max) return a.max;
+        return a.proxy < b.proxy;
+      });
+
+      for (uint32_t i = 0; i < endpoints.size(); ++i) setEndpointIndex(axis, i);
+    }
+
+    freeProxies.insert(freeProxies.end(), batchFreed.begin(), batchFreed.end());
+    batchFreed.clear();
+    rebuildPairs();
+  }
+
+  void SweepAndPrune::beginFrame() {
+    pairEvents.clear();
+    addedPairs.clear();
+    removedPairs.clear();
+    maxWidth = 0.0f;
+    for (const Proxy& proxy : proxies) {
+      if (proxy.active) maxWidth = std::max(maxWidth, proxy.bounds.w);
+    }
+  }
+
+  void SweepAndPrune::endFrame() {
+    resolvedEvents.clear();
+    for (const PairEvent& event : pairEvents) {
+      if (!resolvedEvents.insert(event.key).second) continue;
+      const bool present = pairs.find(event.key) != pairs.end();
+      if (event.added && present) {
+        addedPairs.push_back(event.colliders);
+      } else if (!event.added && !present) {
+        removedPairs.push_back(event.colliders);
+      }
+    }
+    pairEvents.clear();
+
+    freeProxies.insert(freeProxies.end(), frameFreed.begin(), frameFreed.end());
+    frameFreed.clear();
+  }
+
+  uint64_t SweepAndPrune::pairKey(ProxyId a, ProxyId b) {
+    if (a > b) std::swap(a, b);
+    return (static_cast<uint64_t>(a) << Constants::BIT_32) | static_cast<uint64_t>(b);
+  }
+
+  bool SweepAndPrune::overlapsOnOtherAxes(ProxyId a, ProxyId b, int axis) const {
+    const Proxy& pa = proxies[a];
+    const Proxy& pb = proxies[b];
+    for (int other = 0; other < AXIS_COUNT; ++other) {
+      if (other == axis) continue;
+      if (pa.max[other] < pb.min[other] || pb.max[other] < pa.min[other]) return false;
+    }
+    return true;
+  }
+
+  void SweepAndPrune::addPair(ProxyId a, ProxyId b) {
+    const uint64_t key = pairKey(a, b);
+    if (!pairs.insert(key).second) return;
+    pairEvents.push_back(PairEvent{key, true, Pair{proxies[a].collider, proxies[b].collider}});
+  }
+
+  void SweepAndPrune::removePair(ProxyId a, ProxyId b) {
+    const uint64_t key = pairKey(a, b);
+    if (pairs.erase(key) == 0) return;
+    pairEvents.push_back(PairEvent{key, false, Pair{proxies[a].collider, proxies[b].collider}});
+  }
+
+  void SweepAndPrune::rebuildPairs() {
+    previousPairs.swap(pairs);
+    pairs.clear();
+
+    sweepActive.clear();
+    sweepSlots.resize(proxies.size());
+    for (const Endpoint& endpoint : axes[0]) {
+      if (endpoint.max) {
+        const uint32_t slot = sweepSlots[endpoint.proxy];
+        const ProxyId last = sweepActive.back();
+        sweepActive[slot] = last;
+        sweepSlots[last] = slot;
+        sweepActive.pop_back();
+        continue;
+      }
+
+      for (ProxyId other : sweepActive) {
+        if (!overlapsOnOtherAxes(endpoint.proxy, other, 0)) continue;
+        const uint64_t key = pairKey(endpoint.proxy, other);
+        pairs.insert(key);
+        if (previousPairs.erase(key) == 0) {
+          pairEvents.push_back(PairEvent{key, true, Pair{proxies[endpoint.proxy].collider, proxies[other].collider}});
+        }
+      }
+      sweepSlots[endpoint.proxy] = static_cast<uint32_t>(sweepActive.size());
+      sweepActive.push_back(endpoint.proxy);
+    }
+
+    for (uint64_t key : previousPairs) {
+      const ProxyId a = static_cast<ProxyId>(key >> Constants::BIT_32);
+      const ProxyId b = static_cast<ProxyId>(key);
+      pairEvents.push_back(PairEvent{key, false, Pair{proxies[a].collider, proxies[b].collider}});
+    }
+    previousPairs.clear();
+  }
+
+  void SweepAndPrune::setEndpointIndex(int axis, uint32_t index) {
+    const Endpoint& endpoint = axes[axis][index];
+    Proxy& proxy = proxies[endpoint.proxy];
+    if (endpoint.max) {
+      proxy.max[axis] = index;
+    } else {
+      proxy.min[axis] = index;
+    }
+  }
+
+  void SweepAndPrune::sortDown(int axis, uint32_t index, bool updatePairs) {
+    auto& endpoints = axes[axis];
+    while (index > 0 && endpoints[index - 1].value > endpoints[index].value) {
+      const Endpoint& current = endpoints[index];
+      const Endpoint& previous = endpoints[index - 1];
+      if (updatePairs && current.proxy != previous.proxy) {
+        if (!current.max && previous.max) {
+          if (overlapsOnOtherAxes(current.proxy, previous.proxy, axis)) addPair(current.proxy, previous.proxy);
+        } else if (current.max && !previous.max) {
+          removePair(current.proxy, previous.proxy);
+        }
+      }
+      std::swap(endpoints[index], endpoints[index - 1]);
+      setEndpointIndex(axis, index);
+      setEndpointIndex(axis, index - 1);
+      --index;
+    }
+  }
+
+  void SweepAndPrune::sortUp(int axis, uint32_t index, bool updatePairs) {
+    auto& endpoints = axes[axis];
+    while (index + 1 < endpoints.size() && endpoints[index + 1].value < endpoints[index].value) {
+      const Endpoint& current = endpoints[index];
+      const Endpoint& next = endpoints[index + 1];
+      if (updatePairs && current.proxy != next.proxy) {
+        if (current.max && !next.max) {
+          if (overlapsOnOtherAxes(current.proxy, next.proxy, axis)) addPair(current.proxy, next.proxy);
+        } else if (!current.max && next.max) {
+          removePair(current.proxy, next.proxy);
         }
       }
+      std::swap(endpoints[index], endpoints[index + 1]);
+      setEndpointIndex(axis, index);
+      setEndpointIndex(axis, index + 1);
+      ++index;
     }
-    return pairs;
   }
 }
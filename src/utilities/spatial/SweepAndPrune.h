@@ -1,18 +1,129 @@
 #ifndef SWEEP_AND_PRUNE_H
 #define SWEEP_AND_PRUNE_H
 
-#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
 #include <utility>
+#include <vector>
+
 #include <SDL.h>
 
 #include "SpatialHashGrid.h"
+#include "libraries/constants/NumericConstants.h"
 
 namespace Project::Utilities {
   class SweepAndPrune {
   public:
-    using Pair = std::pair<Collider, Collider>;
-    static std::vector<Pair> findPairs(const std::vector<std::pair<SDL_FRect, Collider>>& objects);
+    using Pair = ColliderPair;
+    using ProxyId = uint32_t;
+    static constexpr ProxyId NULL_PROXY = std::numeric_limits<ProxyId>::max();
+
+    ProxyId insert(const SDL_FRect& bounds, const Collider& collider);
+    void remove(ProxyId proxy);
+    void move(ProxyId proxy, const SDL_FRect& bounds);
+    void clear();
+
+    void beginFrame();
+    void endFrame();
+
+    void beginBatch();
+    void endBatch();
+    bool isBatching() const { return batching; }
+
+    const Collider& getCollider(ProxyId proxy) const { return proxies[proxy].collider; }
+    void setCollider(ProxyId proxy, const Collider& collider) { proxies[proxy].collider = collider; }
+
+    const std::vector<Pair>& getAddedPairs() const { return addedPairs; }
+    const std::vector<Pair>& getRemovedPairs() const { return removedPairs; }
+    size_t getPairCount() const { return pairs.size(); }
+    size_t getProxyCount() const { return proxies.size() - freeProxies.size() - batchFreed.size() - frameFreed.size(); }
+
+    template <typename F>
+    void forEachPair(F&& callback) const;
+    template <typename F>
+    void query(const SDL_FRect& area, F&& callback) const;
+
+  private:
+    static constexpr int AXIS_COUNT = 2;
+
+    struct Endpoint {
+      float value = 0.0f;
+      ProxyId proxy = NULL_PROXY;
+      bool max = false;
+    };
+
+    struct Proxy {
+      SDL_FRect bounds{0.f, 0.f, 0.f, 0.f};
+      Collider collider{};
+      uint32_t min[AXIS_COUNT]{0, 0};
+      uint32_t max[AXIS_COUNT]{0, 0};
+      bool active = false;
+    };
+
+    struct PairEvent {
+      uint64_t key = 0;
+      bool added = false;
+      Pair colliders;
+    };
+
+    std::vector<Endpoint> axes[AXIS_COUNT];
+    std::vector<Proxy> proxies;
+    std::vector<ProxyId> freeProxies;
+    std::vector<ProxyId> batchFreed;
+    std::vector<ProxyId> frameFreed;
+    std::unordered_set<uint64_t> pairs;
+    std::unordered_set<uint64_t> previousPairs;
+    std::vector<ProxyId> sweepActive;
+    std::vector<uint32_t> sweepSlots;
+    bool batching = false;
+
+    std::vector<PairEvent> pairEvents;
+    std::unordered_set<uint64_t> resolvedEvents;
+    std::vector<Pair> addedPairs;
+    std::vector<Pair> removedPairs;
+    float maxWidth = 0.0f;
+
+    static uint64_t pairKey(ProxyId a, ProxyId b);
+    static float minValue(const SDL_FRect& bounds, int axis) { return axis == 0 ? bounds.x : bounds.y; }
+    static float maxValue(const SDL_FRect& bounds, int axis) { return axis == 0 ? bounds.x + bounds.w : bounds.y + bounds.h; }
+
+    bool overlapsOnOtherAxes(ProxyId a, ProxyId b, int axis) const;
+    void addPair(ProxyId a, ProxyId b);
+    void removePair(ProxyId a, ProxyId b);
+    void setEndpointIndex(int axis, uint32_t index);
+    void sortDown(int axis, uint32_t index, bool updatePairs);
+    void sortUp(int axis, uint32_t index, bool updatePairs);
+    void rebuildPairs();
   };
+
+  template <typename F>
+  void SweepAndPrune::forEachPair(F&& callback) const {
+    for (uint64_t key : pairs) {
+      const Proxy& a = proxies[static_cast<ProxyId>(key >> Project::Libraries::Constants::BIT_32)];
+      const Proxy& b = proxies[static_cast<ProxyId>(key)];
+      callback(a.collider, b.collider);
+    }
+  }
+
+  template <typename F>
+  void SweepAndPrune::query(const SDL_FRect& area, F&& callback) const {
+    const auto& endpoints = axes[0];
+    const float start = area.x - maxWidth;
+    const float end = area.x + area.w;
+    auto it = std::lower_bound(endpoints.begin(), endpoints.end(), start, [](const Endpoint& endpoint, float value) {
+      return endpoint.value < value;
+    });
+
+    for (; it != endpoints.end() && it->value <= end; ++it) {
+      if (it->max) continue;
+      const Proxy& proxy = proxies[it->proxy];
+      if (SDL_HasIntersectionF(&proxy.bounds, &area)) {
+        callback(proxy.collider);
+      }
+    }
+  }
 }
 
 #endif
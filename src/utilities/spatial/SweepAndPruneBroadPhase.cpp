@@ -0,0 +1,71 @@
+#include "SweepAndPruneBroadPhase.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  void SweepAndPruneBroadPhase::build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect&) {
+    ++frame;
+    sap.beginFrame();
+
+    moved.clear();
+    pending.clear();
+    for (size_t i = 0; i < proxies.size(); ++i) {
+      auto it = ids.find(proxies[i].collider.box);
+      if (it == ids.end() || it->second.id == SweepAndPrune::NULL_PROXY) {
+        pending.push_back(i);
+      } else {
+        it->second.frame = frame;
+        moved.emplace_back(i, &it->second);
+      }
+    }
+
+    const size_t stale = ids.size() > moved.size() ? ids.size() - moved.size() : 0;
+    const bool batch = sap.getProxyCount() == 0 ||
+      pending.size() + stale >= Constants::SWEEP_AND_PRUNE_BATCH_THRESHOLD;
+    if (batch) sap.beginBatch();
+
+    for (const auto& [index, entry] : moved) {
+      const BroadPhaseProxy& proxy = proxies[index];
+      const auto& current = sap.getCollider(entry->id);
+      if (current.physics != proxy.collider.physics || current.entity != proxy.collider.entity) {
+        sap.setCollider(entry->id, proxy.collider);
+      }
+      sap.move(entry->id, proxy.bounds);
+    }
+
+    for (auto it = ids.begin(); it != ids.end();) {
+      if (it->second.frame != frame) {
+        sap.remove(it->second.id);
+        it = ids.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    for (size_t index : pending) {
+      const BroadPhaseProxy& proxy = proxies[index];
+      Proxy& entry = ids[proxy.collider.box];
+      if (entry.frame == frame) continue;
+      entry.id = sap.insert(proxy.bounds, proxy.collider);
+      entry.frame = frame;
+    }
+
+    if (batch) sap.endBatch();
+    sap.endFrame();
+  }
+
+  void SweepAndPruneBroadPhase::query(const SDL_FRect& area, const QueryCallback& callback) const {
+    sap.query(area, callback);
+  }
+
+  bool SweepAndPruneBroadPhase::collectPairs(std::vector<ColliderPair>& pairs) const {
+    pairs.reserve(pairs.size() + sap.getPairCount());
+    sap.forEachPair([&pairs](const Collider& a, const Collider& b) { pairs.emplace_back(a, b); });
+    return true;
+  }
+
+  void SweepAndPruneBroadPhase::clear() {
+    sap.clear();
+    ids.clear();
+  }
+}
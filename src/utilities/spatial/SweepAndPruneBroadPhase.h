@@ -0,0 +1,42 @@
+#ifndef SWEEP_AND_PRUNE_BROAD_PHASE_H
+#define SWEEP_AND_PRUNE_BROAD_PHASE_H
+
+#include "BroadPhase.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "SweepAndPrune.h"
+
+namespace Project::Utilities {
+  class SweepAndPruneBroadPhase : public BroadPhase {
+  public:
+    using BroadPhase::query;
+
+    BroadPhaseType getType() const override { return BroadPhaseType::SWEEP_AND_PRUNE; }
+    void build(const std::vector<BroadPhaseProxy>& proxies, const SDL_FRect& worldBounds) override;
+    void query(const SDL_FRect& area, const QueryCallback& callback) const override;
+    void clear() override;
+
+    bool tracksPairs() const override { return true; }
+    bool collectPairs(std::vector<ColliderPair>& pairs) const override;
+    const std::vector<ColliderPair>& getAddedPairs() const override { return sap.getAddedPairs(); }
+    const std::vector<ColliderPair>& getRemovedPairs() const override { return sap.getRemovedPairs(); }
+
+  private:
+    struct Proxy {
+      SweepAndPrune::ProxyId id = SweepAndPrune::NULL_PROXY;
+      uint64_t frame = 0;
+    };
+
+    SweepAndPrune sap;
+    std::unordered_map<Project::Components::BoundingBoxComponent*, Proxy> ids;
+    std::vector<std::pair<size_t, Proxy*>> moved;
+    std::vector<size_t> pending;
+    uint64_t frame = 0;
+  };
+}
+
+#endif
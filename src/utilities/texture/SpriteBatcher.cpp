@@ -0,0 +1,106 @@
+#include "SpriteBatcher.h"
+
+#include <cmath>
+
+#include "libraries/constants/Constants.h"
+#include "utilities/profiler/Profiler.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  SpriteBatcher::SpriteBatcher() {
+    vertices.reserve(Constants::SPRITE_BATCH_INITIAL_QUADS * Constants::INDEX_FOUR);
+    indices.reserve(Constants::SPRITE_BATCH_INITIAL_QUADS * Constants::INDEX_SIX);
+  }
+
+  void SpriteBatcher::begin(SDL_Renderer* _renderer) {
+    renderer = _renderer;
+    texture = nullptr;
+    vertices.clear();
+    indices.clear();
+    batchCount = 0;
+    spriteCount = 0;
+  }
+
+  void SpriteBatcher::draw(SDL_Texture* _texture, SDL_BlendMode _blendMode, const SDL_Rect* src, const SDL_FRect& dst, float angle) {
+    if (!renderer || !_texture) return;
+    if (_texture != texture || _blendMode != blendMode) {
+      flush();
+      bind(_texture, _blendMode);
+    }
+
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = Constants::DEFAULT_WHOLE;
+    float v1 = Constants::DEFAULT_WHOLE;
+    if (src && textureWidth > 0.0f && textureHeight > 0.0f) {
+      u0 = static_cast<float>(src->x) / textureWidth;
+      v0 = static_cast<float>(src->y) / textureHeight;
+      u1 = static_cast<float>(src->x + src->w) / textureWidth;
+      v1 = static_cast<float>(src->y + src->h) / textureHeight;
+    }
+
+    SDL_FPoint corners[Constants::INDEX_FOUR] = {
+      {dst.x, dst.y},
+      {dst.x + dst.w, dst.y},
+      {dst.x + dst.w, dst.y + dst.h},
+      {dst.x, dst.y + dst.h}
+    };
+
+    if (angle != 0.0f) {
+      const float rad = angle * static_cast<float>(M_PI) / Constants::ANGLE_180_DEG;
+      const float c = std::cos(rad);
+      const float s = std::sin(rad);
+      const float cx = dst.x + dst.w * Constants::DEFAULT_HALF;
+      const float cy = dst.y + dst.h * Constants::DEFAULT_HALF;
+      for (auto& p : corners) {
+        const float rx = p.x - cx;
+        const float ry = p.y - cy;
+        p.x = rx * c - ry * s + cx;
+        p.y = rx * s + ry * c + cy;
+      }
+    }
+
+    const SDL_FPoint uvs[Constants::INDEX_FOUR] = {{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}};
+    const int base = static_cast<int>(vertices.size());
+    for (int i = 0; i < Constants::INDEX_FOUR; ++i) {
+      vertices.push_back(SDL_Vertex{corners[i], tint, uvs[i]});
+    }
+    for (int index : Constants::RECTANGLE_INDICES) {
+      indices.push_back(base + index);
+    }
+    ++spriteCount;
+  }
+
+  void SpriteBatcher::flush() {
+    if (!renderer || !texture || indices.empty()) return;
+    SDL_SetTextureBlendMode(texture, blendMode);
+    SDL_RenderGeometry(renderer, texture,
+      vertices.data(), static_cast<int>(vertices.size()),
+      indices.data(), static_cast<int>(indices.size()));
+    Profiler::getInstance().incrementDrawCalls();
+    ++batchCount;
+    vertices.clear();
+    indices.clear();
+  }
+
+  void SpriteBatcher::end() {
+    flush();
+    texture = nullptr;
+  }
+
+  void SpriteBatcher::bind(SDL_Texture* _texture, SDL_BlendMode _blendMode) {
+    texture = _texture;
+    blendMode = _blendMode;
+
+    int w = 0;
+    int h = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+    textureWidth = static_cast<float>(w);
+    textureHeight = static_cast<float>(h);
+
+    tint = Constants::COLOR_WHITE;
+    SDL_GetTextureColorMod(texture, &tint.r, &tint.g, &tint.b);
+    SDL_GetTextureAlphaMod(texture, &tint.a);
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef SPRITE_BATCHER_H
+#define SPRITE_BATCHER_H
+
+#include <vector>
+
+#include <SDL.h>
+
+namespace Project::Utilities {
+  class SpriteBatcher {
+  public:
+    SpriteBatcher();
+
+    void begin(SDL_Renderer* renderer);
+    void draw(SDL_Texture* texture, SDL_BlendMode blendMode, const SDL_Rect* src, const SDL_FRect& dst, float angle);
+    void flush();
+    void end();
+
+    int getBatchCount() const { return batchCount; }
+    int getSpriteCount() const { return spriteCount; }
+
+  private:
+    SDL_Renderer* renderer = nullptr;
+    SDL_Texture* texture = nullptr;
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    SDL_Color tint{0, 0, 0, 0};
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    float textureWidth = 0.0f;
+    float textureHeight = 0.0f;
+
+    int batchCount = 0;
+    int spriteCount = 0;
+
+    void bind(SDL_Texture* texture, SDL_BlendMode blendMode);
+  };
+}
+
+#endif
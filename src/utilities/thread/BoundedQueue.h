@@ -0,0 +1,79 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Utilities {
+  template <typename T>
+  class BoundedQueue {
+  public:
+    explicit BoundedQueue(size_t capacity)
+    : cells(std::make_unique<Cell[]>(capacity)), mask(capacity - 1) {
+      for (size_t i = 0; i < capacity; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    bool push(T& value) {
+      size_t pos = enqueuePos.load(std::memory_order_relaxed);
+      Cell* cell = nullptr;
+      while (true) {
+        cell = &cells[pos & mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+          if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+      cell->value = std::move(value);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(T& value) {
+      size_t pos = dequeuePos.load(std::memory_order_relaxed);
+      Cell* cell = nullptr;
+      while (true) {
+        cell = &cells[pos & mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+          if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+      }
+      value = std::move(cell->value);
+      cell->sequence.store(pos + mask + 1, std::memory_order_release);
+      return true;
+    }
+
+  private:
+    struct Cell {
+      std::atomic<size_t> sequence{0};
+      T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(Project::Libraries::Constants::SZT_64) std::atomic<size_t> enqueuePos{0};
+    alignas(Project::Libraries::Constants::SZT_64) std::atomic<size_t> dequeuePos{0};
+  };
+}
+
+#endif
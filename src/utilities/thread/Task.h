@@ -0,0 +1,78 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Utilities {
+  class Task {
+  public:
+    Task() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+    Task(F&& function) {
+      using Function = std::decay_t<F>;
+      static_assert(sizeof(Function) <= Project::Libraries::Constants::TASK_STORAGE_SIZE, "Task callable exceeds inline storage");
+      static_assert(alignof(Function) <= alignof(std::max_align_t), "Task callable is over-aligned");
+      new (storage) Function(std::forward<F>(function));
+      operations = &Operations<Function>::table;
+    }
+
+    Task(Task&& other) noexcept { moveFrom(other); }
+
+    Task& operator=(Task&& other) noexcept {
+      if (this != &other) {
+        reset();
+        moveFrom(other);
+      }
+      return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { reset(); }
+
+    void operator()() { operations->invoke(storage); }
+    explicit operator bool() const { return operations != nullptr; }
+
+    void reset() {
+      if (operations) {
+        operations->destroy(storage);
+        operations = nullptr;
+      }
+    }
+
+  private:
+    struct Table {
+      void (*invoke)(void*);
+      void (*move)(void*, void*);
+      void (*destroy)(void*);
+    };
+
+    template <typename Function>
+    struct Operations {
+      static void invoke(void* target) { (*static_cast<Function*>(target))(); }
+      static void move(void* dst, void* src) { new (dst) Function(std::move(*static_cast<Function*>(src))); }
+      static void destroy(void* target) { static_cast<Function*>(target)->~Function(); }
+      static constexpr Table table{&invoke, &move, &destroy};
+    };
+
+    alignas(std::max_align_t) unsigned char storage[Project::Libraries::Constants::TASK_STORAGE_SIZE];
+    const Table* operations = nullptr;
+
+    void moveFrom(Task& other) {
+      if (other.operations) {
+        other.operations->move(storage, other.storage);
+        operations = other.operations;
+        other.reset();
+      }
+    }
+  };
+}
+
+#endif
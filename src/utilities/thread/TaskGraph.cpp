@@ -0,0 +1,140 @@
+#include "TaskGraph.h"
+
+#include <exception>
+#include <string>
+#include <thread>
+
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  TaskGraph::TaskGraph(ThreadPool& threadPool) : pool(threadPool) {}
+
+  TaskGraph::~TaskGraph() {
+    wait();
+  }
+
+  JobHandle TaskGraph::add(Task task) {
+    auto node = std::make_unique<Node>();
+    node->task = std::move(task);
+    nodes.push_back(std::move(node));
+    return JobHandle{static_cast<uint32_t>(nodes.size() - 1)};
+  }
+
+  JobHandle TaskGraph::addContinuation(JobHandle parent, Task task) {
+    JobHandle handle = add(std::move(task));
+    precede(parent, handle);
+    return handle;
+  }
+
+  void TaskGraph::precede(JobHandle before, JobHandle after) {
+    if (!before.isValid() || !after.isValid()) return;
+    if (before.index >= nodes.size() || after.index >= nodes.size()) return;
+    nodes[before.index]->continuations.push_back(after.index);
+    ++nodes[after.index]->dependencies;
+  }
+
+  void TaskGraph::dispatch() {
+    if (nodes.empty()) return;
+    wait();
+
+    for (auto& node : nodes) {
+      node->done.store(false, std::memory_order_relaxed);
+      node->remaining.store(node->dependencies, std::memory_order_relaxed);
+    }
+    outstanding.store(nodes.size(), std::memory_order_release);
+
+    for (uint32_t i = 0; i < nodes.size(); ++i) {
+      if (nodes[i]->dependencies == 0) {
+        pool.enqueue([this, i]() { run(i); });
+      }
+    }
+  }
+
+  void TaskGraph::wait(JobHandle handle) {
+    if (!handle.isValid() || handle.index >= nodes.size()) return;
+    waitUntil(&nodes[handle.index]->done);
+  }
+
+  void TaskGraph::wait() {
+    waitUntil(nullptr);
+  }
+
+  void TaskGraph::clear() {
+    wait();
+    nodes.clear();
+  }
+
+  bool TaskGraph::isComplete(JobHandle handle) const {
+    if (!handle.isValid() || handle.index >= nodes.size()) return true;
+    return nodes[handle.index]->done.load(std::memory_order_acquire);
+  }
+
+  void TaskGraph::run(uint32_t index) {
+    active.fetch_add(1, std::memory_order_seq_cst);
+    while (true) {
+      Node& node = *nodes[index];
+      try {
+        node.task();
+      } catch (const std::exception& e) {
+        if (auto* logger = pool.getLogger()) logger->logMessage(std::string("TaskGraph: job exception - ") + e.what());
+      } catch (...) {
+        if (auto* logger = pool.getLogger()) logger->logMessage("TaskGraph: job threw unknown exception");
+      }
+
+      uint32_t next = JobHandle::INVALID_INDEX;
+      for (uint32_t continuation : node.continuations) {
+        if (nodes[continuation]->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) continue;
+        if (next == JobHandle::INVALID_INDEX) {
+          next = continuation;
+        } else {
+          pool.enqueue([this, continuation]() { run(continuation); });
+        }
+      }
+
+      node.done.store(true, std::memory_order_seq_cst);
+      outstanding.fetch_sub(1, std::memory_order_seq_cst);
+      if (waiters.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(completeMutex);
+        completeCv.notify_all();
+      }
+
+      if (next == JobHandle::INVALID_INDEX) break;
+      index = next;
+    }
+    active.fetch_sub(1, std::memory_order_seq_cst);
+  }
+
+  void TaskGraph::waitUntil(const std::atomic<bool>* flag) {
+    auto complete = [this, flag]() {
+      return flag ? flag->load(std::memory_order_acquire) : outstanding.load(std::memory_order_acquire) == 0;
+    };
+
+    size_t spins = 0;
+    while (!complete()) {
+      if (pool.runPendingTask()) {
+        spins = 0;
+        continue;
+      }
+
+      if (++spins < Constants::THREAD_SPIN_COUNT) {
+        std::this_thread::yield();
+        continue;
+      }
+      spins = 0;
+
+      waiters.fetch_add(1, std::memory_order_seq_cst);
+      {
+        std::unique_lock<std::mutex> lock(completeMutex);
+        completeCv.wait(lock, complete);
+      }
+      waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    if (flag) return;
+    while (active.load(std::memory_order_acquire) > 0) {
+      std::this_thread::yield();
+    }
+  }
+}
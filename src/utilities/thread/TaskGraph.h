@@ -0,0 +1,66 @@
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include "Task.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Project::Utilities {
+  struct JobHandle {
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+    uint32_t index = INVALID_INDEX;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+  };
+
+  class TaskGraph {
+  public:
+    explicit TaskGraph(ThreadPool& pool = ThreadPool::getInstance());
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    JobHandle add(Task task);
+    JobHandle addContinuation(JobHandle parent, Task task);
+    void precede(JobHandle before, JobHandle after);
+
+    void dispatch();
+    void wait(JobHandle handle);
+    void wait();
+    void clear();
+
+    bool isComplete(JobHandle handle) const;
+    bool isRunning() const { return outstanding.load(std::memory_order_acquire) > 0; }
+    size_t size() const { return nodes.size(); }
+
+  private:
+    struct Node {
+      Task task;
+      std::vector<uint32_t> continuations;
+      uint32_t dependencies = 0;
+      std::atomic<uint32_t> remaining{0};
+      std::atomic<bool> done{false};
+    };
+
+    ThreadPool& pool;
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::atomic<size_t> outstanding{0};
+    std::atomic<size_t> waiters{0};
+    std::atomic<size_t> active{0};
+    std::condition_variable completeCv;
+    std::mutex completeMutex;
+
+    void run(uint32_t index);
+    void waitUntil(const std::atomic<bool>* flag);
+  };
+}
+
+#endif
@@ -2,30 +2,48 @@
 
 #include <algorithm>
 #include <exception>
+#include <limits>
+
+#include "libraries/constants/NumericConstants.h"
 
 namespace Project::Utilities {
+  namespace Constants = Project::Libraries::Constants;
+
+  namespace {
+    constexpr size_t NO_WORKER = std::numeric_limits<size_t>::max();
+
+    thread_local ThreadPool* currentPool = nullptr;
+    thread_local size_t currentWorker = NO_WORKER;
+  }
+
   ThreadPool &ThreadPool::getInstance() {
     static ThreadPool instance;
     return instance;
   }
 
-  ThreadPool::ThreadPool()
-    : stop(false), active(0), pending(0), nextQueue(0), contention(0), logger(nullptr) {
-    size_t count = std::max<size_t>(2u, std::thread::hardware_concurrency());
-    taskQueues = std::vector<decltype(taskQueues)::value_type>(count);
+  ThreadPool::ThreadPool(size_t workerCount)
+    : logger(nullptr), injectionQueue(Constants::TASK_QUEUE_CAPACITY),
+      stop(false), pending(0), queued(0), sleeping(0) {
+    size_t count = workerCount > 0 ? workerCount : std::max<size_t>(2u, std::thread::hardware_concurrency());
     workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      workers.push_back(std::make_unique<Worker>());
+    }
 
     for (size_t i = 0; i < count; ++i) {
-      workers.emplace_back(&ThreadPool::worker, this, i);
+      workers[i]->thread = std::thread(&ThreadPool::worker, this, i);
     }
   }
 
   ThreadPool::~ThreadPool() {
     if (logger) logger->logMessage("ThreadPool: shutting down");
-    stop.store(true, std::memory_order_release);
-    cv.notify_all();
-    for (auto &t : workers) {
-      if (t.joinable()) t.join();
+    stop.store(true, std::memory_order_seq_cst);
+    {
+      std::lock_guard<std::mutex> lock(parkMutex);
+      parkCv.notify_all();
+    }
+    for (auto& w : workers) {
+      if (w->thread.joinable()) w->thread.join();
     }
   }
 
@@ -34,69 +52,137 @@ namespace Project::Utilities {
     if (logger) logger->logMessage("ThreadPool: logger attached with " + std::to_string(workers.size()) + " workers");
   }
 
-  void ThreadPool::enqueue(std::function<void()> job) {
-    if (!job || stop.load(std::memory_order_acquire)) return;
-    size_t index = nextQueue.fetch_add(1, std::memory_order_relaxed) % taskQueues.size();
-    taskQueues[index].push(std::move(job));
-    pending.fetch_add(1, std::memory_order_release);
-    std::lock_guard<std::mutex> lock(cvMutex);
-    cv.notify_all();
+  void ThreadPool::submit(Task task) {
+    if (!task || stop.load(std::memory_order_acquire)) return;
+    pending.fetch_add(1, std::memory_order_acq_rel);
+
+    bool pushed = false;
+    if (currentPool == this && currentWorker < workers.size()) {
+      pushed = workers[currentWorker]->deque.push(task);
+    }
+    if (!pushed) {
+      pushed = injectionQueue.push(task);
+    }
+
+    if (!pushed) {
+      execute(task);
+      return;
+    }
+
+    queued.fetch_add(1, std::memory_order_seq_cst);
+    wake();
+  }
+
+  bool ThreadPool::runPendingTask() {
+    size_t index = currentPool == this ? currentWorker : NO_WORKER;
+    Task task;
+    if (!findTask(index, task)) return false;
+    execute(task);
+    return true;
   }
 
   void ThreadPool::wait() {
-    std::unique_lock<std::mutex> lock(cvMutex);
-    cv.wait(lock, [this] {
-      return pending.load(std::memory_order_acquire) == 0 && active.load(std::memory_order_acquire) == 0;
-    });
-    contention.store(0, std::memory_order_release);
+    size_t index = currentPool == this ? currentWorker : NO_WORKER;
+    size_t spins = 0;
+    while (pending.load(std::memory_order_acquire) > 0) {
+      Task task;
+      if (findTask(index, task)) {
+        execute(task);
+        spins = 0;
+        continue;
+      }
+
+      if (++spins < Constants::THREAD_SPIN_COUNT) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(parkMutex);
+      doneCv.wait(lock, [this] {
+        return pending.load(std::memory_order_acquire) == 0 || queued.load(std::memory_order_acquire) > 0;
+      });
+      spins = 0;
+    }
+  }
+
+  bool ThreadPool::findTask(size_t index, Task& task) {
+    bool found = false;
+    if (index < workers.size()) {
+      found = workers[index]->deque.pop(task);
+    }
+    if (!found) {
+      found = injectionQueue.pop(task);
+    }
+    if (!found) {
+      size_t count = workers.size();
+      size_t start = index < count ? index + 1 : 0;
+      for (size_t i = 0; i < count && !found; ++i) {
+        size_t victim = (start + i) % count;
+        if (victim == index) continue;
+        found = workers[victim]->deque.steal(task);
+      }
+    }
+    if (found) {
+      queued.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    return found;
+  }
+
+  void ThreadPool::execute(Task& task) {
+    try {
+      task();
+    } catch (const std::exception &e) {
+      if (logger) logger->logMessage(std::string("ThreadPool: task exception - ") + e.what());
+    } catch (...) {
+      if (logger) logger->logMessage("ThreadPool: task threw unknown exception");
+    }
+    task.reset();
+
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(parkMutex);
+      doneCv.notify_all();
+    }
+  }
+
+  void ThreadPool::wake() {
+    if (sleeping.load(std::memory_order_seq_cst) == 0) return;
+    std::lock_guard<std::mutex> lock(parkMutex);
+    parkCv.notify_one();
+    doneCv.notify_all();
   }
 
   void ThreadPool::worker(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+    size_t spins = 0;
+
     while (true) {
-      std::function<void()> job;
-      bool hasJob = taskQueues[index].pop(job);
-
-      if (!hasJob) {
-        for (size_t i = 0; i < taskQueues.size(); ++i) {
-          if (i == index) continue;
-          if (taskQueues[i].pop(job)) {
-            hasJob = true;
-            break;
-          }
-        }
-      }
-      
-      if (!hasJob) {
-        contention.fetch_add(1, std::memory_order_relaxed);
-        std::unique_lock<std::mutex> lock(cvMutex);
-        cv.wait(lock, [this] {
-          return stop.load(std::memory_order_acquire) || pending.load(std::memory_order_acquire) > 0;
-        });
-        
-        if (stop.load(std::memory_order_acquire) && pending.load(std::memory_order_acquire) == 0) {
-          if (logger) logger->logMessage("ThreadPool: worker exiting");
-          return;
-        }
+      Task task;
+      if (findTask(index, task)) {
+        execute(task);
+        spins = 0;
         continue;
       }
 
-      active.fetch_add(1, std::memory_order_acq_rel);
-      try {
-        job();
-      } catch (const std::exception &e) {
-        if (logger) logger->logMessage(std::string("ThreadPool: task exception - ") + e.what());
-      } catch (...) {
-        if (logger) logger->logMessage("ThreadPool: task threw unknown exception");
+      if (stop.load(std::memory_order_acquire)) {
+        if (logger) logger->logMessage("ThreadPool: worker exiting");
+        return;
       }
 
-      active.fetch_sub(1, std::memory_order_acq_rel);
-      pending.fetch_sub(1, std::memory_order_acq_rel);
+      if (++spins < Constants::THREAD_SPIN_COUNT) {
+        std::this_thread::yield();
+        continue;
+      }
+      spins = 0;
 
-      if (pending.load(std::memory_order_acquire) == 0 &&
-          active.load(std::memory_order_acquire) == 0) {
-        std::lock_guard<std::mutex> lock(cvMutex);
-        cv.notify_all();
+      sleeping.fetch_add(1, std::memory_order_seq_cst);
+      {
+        std::unique_lock<std::mutex> lock(parkMutex);
+        parkCv.wait(lock, [this] {
+          return stop.load(std::memory_order_acquire) || queued.load(std::memory_order_seq_cst) > 0;
+        });
       }
+      sleeping.fetch_sub(1, std::memory_order_seq_cst);
     }
   }
 }
@@ -1,13 +1,16 @@
 #ifndef THREAD_POOL_H
 #define THREAD_POOL_H
 
-#include "LockFreeQueue.h"
+#include "BoundedQueue.h"
+#include "Task.h"
+#include "WorkStealingDeque.h"
 
 #include <atomic>
 #include <condition_variable>
-#include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "utilities/logs_manager/LogsManager.h"
@@ -17,26 +20,46 @@ namespace Project::Utilities {
   public:
     static ThreadPool &getInstance();
 
+    explicit ThreadPool(size_t workerCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
     void setLogger(Project::Utilities::LogsManager* logger);
-    void enqueue(std::function<void()> job);
+    Project::Utilities::LogsManager* getLogger() const { return logger; }
+
+    template <typename F>
+    void enqueue(F&& job) { submit(Task(std::forward<F>(job))); }
+
+    void submit(Task task);
+    bool runPendingTask();
     void wait();
 
+    size_t getWorkerCount() const { return workers.size(); }
+
   private:
-    ThreadPool();
-    ~ThreadPool();
+    struct Worker {
+      WorkStealingDeque deque;
+      std::thread thread;
+    };
 
     Project::Utilities::LogsManager* logger;
 
-    std::vector<std::thread> workers;
-    std::vector<LockFreeQueue<std::function<void()>>> taskQueues;
-    std::condition_variable cv;
-    std::mutex cvMutex;
+    std::vector<std::unique_ptr<Worker>> workers;
+    BoundedQueue<Task> injectionQueue;
+
+    std::condition_variable parkCv;
+    std::condition_variable doneCv;
+    std::mutex parkMutex;
     std::atomic<bool> stop;
-    std::atomic<size_t> active;
     std::atomic<size_t> pending;
-    std::atomic<size_t> nextQueue;
-    std::atomic<size_t> contention;
+    std::atomic<size_t> queued;
+    std::atomic<size_t> sleeping;
 
+    bool findTask(size_t index, Task& task);
+    void execute(Task& task);
+    void wake();
     void worker(size_t index);
   };
 }
@@ -0,0 +1,95 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include "Task.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "libraries/constants/NumericConstants.h"
+
+namespace Project::Utilities {
+  class WorkStealingDeque {
+  public:
+    WorkStealingDeque()
+    : slots(std::make_unique<Slot[]>(Project::Libraries::Constants::TASK_DEQUE_CAPACITY)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    bool push(Task& task) {
+      int64_t b = bottom.load(std::memory_order_relaxed);
+      int64_t t = top.load(std::memory_order_acquire);
+      if (b - t >= static_cast<int64_t>(Project::Libraries::Constants::TASK_DEQUE_CAPACITY)) return false;
+
+      Slot& slot = slots[b & MASK];
+      if (slot.full.load(std::memory_order_acquire)) return false;
+
+      slot.task = std::move(task);
+      slot.full.store(true, std::memory_order_release);
+      bottom.store(b + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(Task& task) {
+      int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+      bottom.store(b, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t t = top.load(std::memory_order_relaxed);
+
+      if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+      }
+
+      if (t == b) {
+        bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        if (!won) return false;
+      }
+
+      take(slots[b & MASK], task);
+      return true;
+    }
+
+    bool steal(Task& task) {
+      int64_t t = top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t b = bottom.load(std::memory_order_acquire);
+      if (t >= b) return false;
+
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+      }
+
+      take(slots[t & MASK], task);
+      return true;
+    }
+
+    bool empty() const {
+      return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr int64_t MASK = static_cast<int64_t>(Project::Libraries::Constants::TASK_DEQUE_CAPACITY) - 1;
+    static_assert((Project::Libraries::Constants::TASK_DEQUE_CAPACITY & MASK) == 0, "Deque capacity must be a power of two");
+
+    struct Slot {
+      std::atomic<bool> full{false};
+      Task task;
+    };
+
+    alignas(Project::Libraries::Constants::SZT_64) std::atomic<int64_t> top{0};
+    alignas(Project::Libraries::Constants::SZT_64) std::atomic<int64_t> bottom{0};
+    std::unique_ptr<Slot[]> slots;
+
+    static void take(Slot& slot, Task& task) {
+      task = std::move(slot.task);
+      slot.full.store(false, std::memory_order_release);
+    }
+  };
+}
+
+#endif